@@ -66,6 +66,8 @@ public class AssetValidation : ModuleRules
 				"AssetReferenceRestrictions", 
 				"Blutility",
 				"AssetManagerEditor", 
+				"Json",
+				"JsonUtilities",
 				// "ScriptPlugin",
 			}
 		);
@@ -1,125 +1,697 @@
 ﻿#include "AssetDependencyTree.h"
 
-#include "AssetValidationStatics.h"
+#include "AssetSizeProvider.h"
+#include "AssetValidationDefines.h"
+#include "AssetValidationSettings.h"
 #include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
 #include "Misc/AssetRegistryInterface.h"
+#include "UObject/ObjectSaveContext.h"
 
-FAssetAuditResult::FAssetAuditResult(const FAssetData& InAssetData)
-	: AssetData(InAssetData)
+namespace UE::AssetValidation
 {
-	
+	static TUniquePtr<FAssetDependencyTree> SharedDependencyTree;
 }
 
-FAssetTreeNode::FAssetTreeNode(IAssetRegistry& AssetRegistry, const FAssetData& InAssetData)
+FAssetAuditResult::FAssetAuditResult(const FAssetData& InAssetData)
 	: AssetData(InAssetData)
 {
-	UE::AssetValidation::GetAssetSizeBytes(AssetRegistry, AssetData, TotalMemorySizeBytes, TotalDiskSizeBytes);
+
 }
 
-bool FAssetTreeNode::IsValid() const
+FAssetDependencyTree::FAssetDependencyTree()
+	: SizeProvider(MakeUnique<UE::AssetValidation::FAssetSizeProvider>())
 {
-	return AssetData.IsValid() && !FMath::IsNearlyZero(TotalDiskSizeBytes) && !FMath::IsNearlyZero(TotalMemorySizeBytes);
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().AddRaw(this, &FAssetDependencyTree::HandleAssetAdded);
+		AssetRegistry->OnAssetRemoved().AddRaw(this, &FAssetDependencyTree::HandleAssetRemoved);
+		AssetRegistry->OnAssetUpdated().AddRaw(this, &FAssetDependencyTree::HandleAssetUpdated);
+		AssetRegistry->OnAssetRenamed().AddRaw(this, &FAssetDependencyTree::HandleAssetRenamed);
+	}
+	
+	UPackage::PackageSavedWithContextEvent.AddRaw(this, &FAssetDependencyTree::HandlePackageSaved);
 }
 
 FAssetDependencyTree::~FAssetDependencyTree()
 {
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().RemoveAll(this);
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+		AssetRegistry->OnAssetUpdated().RemoveAll(this);
+		AssetRegistry->OnAssetRenamed().RemoveAll(this);
+	}
+	
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+
 	Reset();
 }
 
+FAssetDependencyTree& FAssetDependencyTree::Get()
+{
+	check(IsInGameThread());
+	if (!UE::AssetValidation::SharedDependencyTree.IsValid())
+	{
+		UE::AssetValidation::SharedDependencyTree = MakeUnique<FAssetDependencyTree>();
+	}
+
+	return *UE::AssetValidation::SharedDependencyTree;
+}
+
+void FAssetDependencyTree::Shutdown()
+{
+	UE::AssetValidation::SharedDependencyTree.Reset();
+}
+
 bool FAssetDependencyTree::AuditAsset(IAssetRegistry& AssetRegistry, const FAssetData& Asset, FAssetAuditResult& OutResult)
 {
-	TSet<FName> VisitedAssets{};
-	TSharedPtr<FAssetTreeNode> TreeNode = CreateAssetNode(AssetRegistry, Asset, *this, VisitedAssets);
-	if (!TreeNode.IsValid())
+	TArray<FAssetAuditResult> Results;
+	if (AuditAssets(AssetRegistry, MakeArrayView(&Asset, 1), Results))
 	{
-		return false;
+		OutResult = MoveTemp(Results[0]);
+		return true;
 	}
 
-	constexpr int32 StartDepth = 1;
-	AuditAsset(TreeNode, OutResult, StartDepth);
+	return false;
+}
 
-	return true;
+bool FAssetDependencyTree::AuditAssets(IAssetRegistry& AssetRegistry, TConstArrayView<FAssetData> Assets, TArray<FAssetAuditResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetDependencyTree::AuditAssets, AssetValidationChannel);
+
+	FScopeLock Lock{&CriticalSection};
+	// asset registry changes caused by loading assets for size estimation are applied after audit is complete
+	bAuditInProgress = true;
+
+	bool bSuccess = true;
+	OutResults.Reset(Assets.Num());
+
+	TArray<FNodeIndex> RootNodes;
+	for (const FAssetData& Asset: Assets)
+	{
+		FAssetAuditResult& Result = OutResults.Emplace_GetRef(Asset);
+		if (!Asset.IsValid())
+		{
+			bSuccess = false;
+			continue;
+		}
+
+		const FNodeIndex RootIndex = FindOrAddNode(Asset);
+		if (!Nodes[RootIndex].bAuditResultValid)
+		{
+			RootNodes.AddUnique(RootIndex);
+		}
+	}
+
+	if (!RootNodes.IsEmpty())
+	{
+		TArray<FNodeIndex> ReachableNodes;
+		ResolveReachableNodes(AssetRegistry, RootNodes, ReachableNodes);
+		ComputeAuditResults(RootNodes, ReachableNodes);
+	}
+
+	for (FAssetAuditResult& Result: OutResults)
+	{
+		if (const FNodeIndex* NodeIndex = Result.AssetData.IsValid() ? NodeIndices.Find(Result.AssetData.PackageName) : nullptr)
+		{
+			check(Nodes[*NodeIndex].bAuditResultValid);
+			Result = Nodes[*NodeIndex].AuditResult;
+		}
+	}
+
+	bAuditInProgress = false;
+	ApplyPendingChanges();
+
+	return bSuccess;
+}
+
+void FAssetDependencyTree::InvalidatePackage(FName PackageName)
+{
+	FScopeLock Lock{&CriticalSection};
+	HandlePackageChanged(PackageName, false);
 }
 
 void FAssetDependencyTree::Reset()
 {
-	TreeNodes.Reset();
+	FScopeLock Lock{&CriticalSection};
+
+	check(!bAuditInProgress);
+	SizeProvider->SaveCache();
+	Nodes.Reset();
+	FreeNodes.Reset();
+	NodeIndices.Reset();
+	PendingChanges.Reset();
 }
 
-TSharedPtr<FAssetTreeNode> FAssetDependencyTree::CreateAssetNode(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, FAssetDependencyTree& DependencyTree, TSet<FName>& VisitedAssets)
+void FAssetDependencyTree::SetAllowAssetUnloading(bool bAllow)
 {
-	check(AssetData.IsValid());
-	check(!VisitedAssets.Contains(AssetData.PackageName));
-	VisitedAssets.Add(AssetData.PackageName);
-	
-	FAssetIdentifier AssetId{AssetData.PackageName};
-	if (TSharedPtr<FAssetTreeNode>* AssetNode = DependencyTree.TreeNodes.Find(AssetId))
+	FScopeLock Lock{&CriticalSection};
+	bAllowAssetUnloading = bAllow;
+}
+
+void FAssetDependencyTree::UnloadAssets()
+{
+	FScopeLock Lock{&CriticalSection};
+	check(!bAuditInProgress);
+	SizeProvider->UnloadAssets();
+}
+
+FAssetDependencyTree::FNodeIndex FAssetDependencyTree::FindOrAddNode(const FAssetData& AssetData)
+{
+	if (const FNodeIndex* NodeIndex = NodeIndices.Find(AssetData.PackageName))
+	{
+		return *NodeIndex;
+	}
+
+	const FNodeIndex NodeIndex = FreeNodes.IsEmpty() ? Nodes.AddDefaulted() : FreeNodes.Pop();
+
+	FAssetNode& Node = Nodes[NodeIndex];
+	Node.AssetData = AssetData;
+	Node.bAllocated = true;
+
+	NodeIndices.Add(AssetData.PackageName, NodeIndex);
+	return NodeIndex;
+}
+
+void FAssetDependencyTree::ResolveNode(IAssetRegistry& AssetRegistry, FNodeIndex NodeIndex)
+{
+	if (!Nodes[NodeIndex].bSizeValid)
 	{
-		return *AssetNode;
+		FAssetNode& Node = Nodes[NodeIndex];
+		SizeProvider->GetAssetSizeBytes(AssetRegistry, Node.AssetData, Node.MemorySizeBytes, Node.DiskSizeBytes);
+		Node.bSizeValid = true;
 	}
 
-	// @todo: large block allocations instead of shared references
-	TSharedPtr<FAssetTreeNode> AssetNode = DependencyTree.TreeNodes.Add(AssetId, MakeShared<FAssetTreeNode>(AssetRegistry, AssetData));
+	if (Nodes[NodeIndex].bDependenciesValid)
+	{
+		return;
+	}
+
+	TArray<FNodeIndex> OldDependencies = MoveTemp(Nodes[NodeIndex].Dependencies);
+	for (const FNodeIndex Dependency: OldDependencies)
+	{
+		Nodes[Dependency].Referencers.RemoveSwap(NodeIndex);
+	}
+
+	const FName PackageName = Nodes[NodeIndex].AssetData.PackageName;
 
 	TArray<FName> Dependencies;
-	// @todo: not only hard dependencies
-	AssetRegistry.GetDependencies(AssetData.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
-	
+	AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+	TArray<FNodeIndex> NewDependencies;
+	NewDependencies.Reserve(Dependencies.Num());
+
 	for (FName Dependency: Dependencies)
 	{
-		FAssetIdentifier DependencyId{Dependency};
-		const FString DependencyStr = Dependency.ToString();
-		
-		if (FPackageName::IsScriptPackage(DependencyStr))
-		{
-			// ignore script packages because they're not interesting
-			continue;
-		}
-
-		if (VisitedAssets.Contains(Dependency))
+		if (Dependency == PackageName)
 		{
-			// already visited dependency
 			continue;
 		}
 
-		TSharedPtr<FAssetTreeNode> DependencyNode{};
-		if (TSharedPtr<FAssetTreeNode>* DependencyNodePtr = DependencyTree.TreeNodes.Find(DependencyId))
+		FNodeIndex DependencyIndex = INDEX_NONE;
+		if (const FNodeIndex* DependencyIndexPtr = NodeIndices.Find(Dependency))
 		{
 			// found existing node
-			DependencyNode = *DependencyNodePtr;
+			DependencyIndex = *DependencyIndexPtr;
 		}
 		else
 		{
+			const FString DependencyStr = Dependency.ToString();
+			if (FPackageName::IsScriptPackage(DependencyStr))
+			{
+				// ignore script packages because they're not interesting
+				continue;
+			}
+
 			const FString DependencyPath = FString::Printf(TEXT("%s.%s"), *DependencyStr, *FPackageName::GetLongPackageAssetName(DependencyStr));
-			
 			if (FAssetData DependencyAsset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath{DependencyPath}); DependencyAsset.IsValid())
 			{
-				DependencyNode = CreateAssetNode(AssetRegistry, DependencyAsset, DependencyTree, VisitedAssets);
+				DependencyIndex = FindOrAddNode(DependencyAsset);
 			}
-			
 		}
-		if (DependencyNode.IsValid())
+
+		if (DependencyIndex != INDEX_NONE)
 		{
-			AssetNode->Children.Add(DependencyNode);
+			NewDependencies.AddUnique(DependencyIndex);
+			Nodes[DependencyIndex].Referencers.AddUnique(NodeIndex);
 		}
 	}
 
-	return AssetNode;
+	FAssetNode& Node = Nodes[NodeIndex];
+	Node.Dependencies = MoveTemp(NewDependencies);
+	Node.bDependenciesValid = true;
 }
 
-void FAssetDependencyTree::AuditAsset(const TSharedPtr<FAssetTreeNode>& TreeNode, FAssetAuditResult& OutResult, int32 CurrentDepth)
+void FAssetDependencyTree::ResolveReachableNodes(IAssetRegistry& AssetRegistry, TConstArrayView<FNodeIndex> RootNodes, TArray<FNodeIndex>& OutReachableNodes)
 {
-	check(TreeNode.IsValid());
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetDependencyTree::ResolveReachableNodes, AssetValidationChannel);
+	check(IsInGameThread());
+
+	const int32 UnloadBatchSize = UAssetValidationSettings::Get()->AuditUnloadBatchSize;
 	
-	OutResult.Add(TreeNode);
+	TBitArray<> VisitedNodes{false, Nodes.Num()};
+	TArray<FNodeIndex> NodeStack{RootNodes};
+	for (const FNodeIndex RootIndex: RootNodes)
+	{
+		VisitedNodes[RootIndex] = true;
+	}
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FNodeIndex NodeIndex = NodeStack.Pop();
+		OutReachableNodes.Add(NodeIndex);
+		
+		// resolving a node may allocate nodes for its dependencies
+		ResolveNode(AssetRegistry, NodeIndex);
+		VisitedNodes.SetNum(Nodes.Num(), false);
+
+		if (bAllowAssetUnloading && SizeProvider->GetNumLoadedAssets() >= UnloadBatchSize)
+		{
+			// dependency graph doesn't reference loaded objects, so assets can be unloaded in the middle of the audit
+			SizeProvider->UnloadAssets();
+		}
+
+		for (const FNodeIndex Dependency: Nodes[NodeIndex].Dependencies)
+		{
+			if (!VisitedNodes[Dependency])
+			{
+				VisitedNodes[Dependency] = true;
+				NodeStack.Add(Dependency);
+			}
+		}
+	}
+}
+
+namespace UE::AssetValidation
+{
+	/** Strongly connected component of a dependency graph, circular dependencies are collapsed into a single component */
+	struct FDependencyComponent
+	{
+		TArray<int32> Nodes;
+		/** indices of components this component depends on */
+		TArray<int32> Dependencies;
+		double DiskSizeBytes = 0.0;
+		double MemorySizeBytes = 0.0;
+		/** size of a component and inclusive sizes of its dependencies, shared dependencies are counted once per referencing path */
+		double InclusiveDiskSizeBytes = 0.0;
+		double InclusiveMemorySizeBytes = 0.0;
+		/** topological level, components on the same level are independent from each other */
+		int32 Level = 0;
+		int32 DependencyDepth = 0;
+		int32 MaxDependencyBreadth = 0;
+		/** whether every node of a component has valid memoized depth, breadth and inclusive sizes, so that component is not aggregated again */
+		bool bAggregateValid = true;
+	};
+
+	/**
+	 * Condensed dependency graph, which is guaranteed to be a DAG
+	 * Components are stored in reverse topological order: dependencies of a component always have lower indices
+	 */
+	struct FCondensedDependencyGraph
+	{
+		TArray<FDependencyComponent> Components;
+		/** component index for each dependency tree node, INDEX_NONE for nodes that are not part of the graph */
+		TArray<int32> NodeComponents;
+		/** components grouped by topological level, components on the same level are independent from each other */
+		TArray<TArray<int32>> Levels;
+	};
+
+	/** Per task data for unique size calculation */
+	struct FUniqueSizeContext
+	{
+		TBitArray<> VisitedComponents;
+		TArray<int32> VisitedList;
+		TArray<int32> ComponentStack;
+	};
+}
+
+void FAssetDependencyTree::ComputeAuditResults(TConstArrayView<FNodeIndex> RootNodes, TConstArrayView<FNodeIndex> ReachableNodes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetDependencyTree::ComputeAuditResults, AssetValidationChannel);
+	using namespace UE::AssetValidation;
+	
+	FCondensedDependencyGraph Graph;
+	Graph.NodeComponents.Init(INDEX_NONE, Nodes.Num());
+
+	// find strongly connected components with Tarjan's algorithm. Implemented iteratively, because dependency chains can be very deep
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetDependencyTree::CondenseGraph, AssetValidationChannel);
+		
+		struct FStackFrame
+		{
+			FNodeIndex NodeIndex;
+			int32 NextDependency;
+		};
+
+		TArray<int32> VisitIndex, LowLink;
+		VisitIndex.Init(INDEX_NONE, Nodes.Num());
+		LowLink.Init(INDEX_NONE, Nodes.Num());
+		TBitArray<> OnStack{false, Nodes.Num()};
+
+		TArray<FNodeIndex> ComponentStack;
+		TArray<FStackFrame> CallStack;
+		int32 VisitCounter = 0;
+
+		auto VisitNode = [&](FNodeIndex NodeIndex)
+		{
+			VisitIndex[NodeIndex] = LowLink[NodeIndex] = VisitCounter++;
+			ComponentStack.Add(NodeIndex);
+			OnStack[NodeIndex] = true;
+			CallStack.Add({NodeIndex, 0});
+		};
+
+		for (const FNodeIndex StartIndex: ReachableNodes)
+		{
+			if (VisitIndex[StartIndex] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			VisitNode(StartIndex);
+			while (!CallStack.IsEmpty())
+			{
+				FStackFrame& Frame = CallStack.Last();
+				const FNodeIndex NodeIndex = Frame.NodeIndex;
+				const TArray<FNodeIndex>& Dependencies = Nodes[NodeIndex].Dependencies;
+
+				if (Frame.NextDependency < Dependencies.Num())
+				{
+					const FNodeIndex Dependency = Dependencies[Frame.NextDependency++];
+					if (VisitIndex[Dependency] == INDEX_NONE)
+					{
+						VisitNode(Dependency);
+					}
+					else if (OnStack[Dependency])
+					{
+						LowLink[NodeIndex] = FMath::Min(LowLink[NodeIndex], VisitIndex[Dependency]);
+					}
+					continue;
+				}
+
+				CallStack.Pop();
+				if (LowLink[NodeIndex] == VisitIndex[NodeIndex])
+				{
+					// node is a root of a component, every node above it on the stack belongs to the same component
+					const int32 ComponentIndex = Graph.Components.AddDefaulted();
+					FDependencyComponent& Component = Graph.Components[ComponentIndex];
+
+					FNodeIndex ComponentNode = INDEX_NONE;
+					do
+					{
+						ComponentNode = ComponentStack.Pop();
+						OnStack[ComponentNode] = false;
+						Graph.NodeComponents[ComponentNode] = ComponentIndex;
+						Component.Nodes.Add(ComponentNode);
+					}
+					while (ComponentNode != NodeIndex);
+				}
+
+				if (!CallStack.IsEmpty())
+				{
+					const FNodeIndex ParentIndex = CallStack.Last().NodeIndex;
+					LowLink[ParentIndex] = FMath::Min(LowLink[ParentIndex], LowLink[NodeIndex]);
+				}
+			}
+		}
+	}
+
+	// gather component sizes and dependencies, assign topological levels
+	for (int32 ComponentIndex = 0; ComponentIndex < Graph.Components.Num(); ++ComponentIndex)
+	{
+		FDependencyComponent& Component = Graph.Components[ComponentIndex];
+
+		int32 Level = 0;
+		for (const FNodeIndex NodeIndex: Component.Nodes)
+		{
+			const FAssetNode& Node = Nodes[NodeIndex];
+			Component.DiskSizeBytes += Node.DiskSizeBytes;
+			Component.MemorySizeBytes += Node.MemorySizeBytes;
+			Component.MaxDependencyBreadth = FMath::Max(Component.MaxDependencyBreadth, Node.Dependencies.Num());
+			Component.bAggregateValid &= Node.bAggregateValid;
+
+			for (const FNodeIndex Dependency: Node.Dependencies)
+			{
+				const int32 DependencyComponent = Graph.NodeComponents[Dependency];
+				check(DependencyComponent != INDEX_NONE && DependencyComponent <= ComponentIndex);
+				
+				if (DependencyComponent != ComponentIndex)
+				{
+					Component.Dependencies.AddUnique(DependencyComponent);
+					Level = FMath::Max(Level, Graph.Components[DependencyComponent].Level + 1);
+				}
+			}
+		}
+
+		if (Component.bAggregateValid)
+		{
+			// nodes of a circular dependency share memoized data, and memoized data of their dependencies is valid as well
+			const FAssetNode& Node = Nodes[Component.Nodes[0]];
+			Component.DependencyDepth = Node.DependencyDepth;
+			Component.MaxDependencyBreadth = Node.MaxDependencyBreadth;
+			Component.InclusiveDiskSizeBytes = Node.InclusiveDiskSizeBytes;
+			Component.InclusiveMemorySizeBytes = Node.InclusiveMemorySizeBytes;
+		}
+
+		Component.Level = Level;
+		if (Graph.Levels.Num() < Level + 1)
+		{
+			Graph.Levels.SetNum(Level + 1);
+		}
+		Graph.Levels[Level].Add(ComponentIndex);
+	}
+
+	// aggregate depth, breadth and inclusive sizes level by level. Components on a level depend only on components from lower levels
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetDependencyTree::AggregateLevels, AssetValidationChannel);
+		
+		for (const TArray<int32>& Level: Graph.Levels)
+		{
+			ParallelFor(TEXT("AssetValidation.AggregateDependencies"), Level.Num(), 64, [&Graph, &Level](int32 Index)
+			{
+				FDependencyComponent& Component = Graph.Components[Level[Index]];
+				if (Component.bAggregateValid)
+				{
+					// memoized by a previous audit
+					return;
+				}
+
+				int32 DependencyDepth = 0;
+				Component.InclusiveDiskSizeBytes = Component.DiskSizeBytes;
+				Component.InclusiveMemorySizeBytes = Component.MemorySizeBytes;
+				for (const int32 Dependency: Component.Dependencies)
+				{
+					const FDependencyComponent& DependencyComponent = Graph.Components[Dependency];
+					Component.MaxDependencyBreadth = FMath::Max(Component.MaxDependencyBreadth, DependencyComponent.MaxDependencyBreadth);
+					DependencyDepth = FMath::Max(DependencyDepth, DependencyComponent.DependencyDepth);
+					Component.InclusiveDiskSizeBytes += DependencyComponent.InclusiveDiskSizeBytes;
+					Component.InclusiveMemorySizeBytes += DependencyComponent.InclusiveMemorySizeBytes;
+				}
+
+				Component.DependencyDepth = DependencyDepth + 1;
+			});
+		}
+	}
+
+	for (const FNodeIndex NodeIndex: ReachableNodes)
+	{
+		const FDependencyComponent& Component = Graph.Components[Graph.NodeComponents[NodeIndex]];
+		if (Component.bAggregateValid)
+		{
+			continue;
+		}
+
+		FAssetNode& Node = Nodes[NodeIndex];
+		Node.DependencyDepth = Component.DependencyDepth;
+		Node.MaxDependencyBreadth = Component.MaxDependencyBreadth;
+		Node.InclusiveDiskSizeBytes = Component.InclusiveDiskSizeBytes;
+		Node.InclusiveMemorySizeBytes = Component.InclusiveMemorySizeBytes;
+		Node.bAggregateValid = true;
+	}
+
+	// inclusive sizes are aggregated bottom-up, counting shared dependencies once per path.
+	// Unique sizes are computed by iterating over unique reachable components for each root
+	TArray<FUniqueSizeContext> TaskContexts;
+	ParallelForWithTaskContext(TEXT("AssetValidation.AuditAssets"), TaskContexts, RootNodes.Num(), 1, [this, &Graph, &RootNodes](FUniqueSizeContext& Context, int32 Index)
+	{
+		const FNodeIndex RootIndex = RootNodes[Index];
+		const int32 RootComponent = Graph.NodeComponents[RootIndex];
+		
+		Context.VisitedComponents.SetNum(Graph.Components.Num(), false);
+		Context.VisitedComponents[RootComponent] = true;
+		Context.VisitedList.Add(RootComponent);
+		Context.ComponentStack.Add(RootComponent);
+
+		double DiskSizeBytes = 0.0, MemorySizeBytes = 0.0;
+		int32 NumNodes = 0;
+		
+		while (!Context.ComponentStack.IsEmpty())
+		{
+			const FDependencyComponent& Component = Graph.Components[Context.ComponentStack.Pop()];
+			DiskSizeBytes += Component.DiskSizeBytes;
+			MemorySizeBytes += Component.MemorySizeBytes;
+			NumNodes += Component.Nodes.Num();
+
+			for (const int32 Dependency: Component.Dependencies)
+			{
+				if (!Context.VisitedComponents[Dependency])
+				{
+					Context.VisitedComponents[Dependency] = true;
+					Context.VisitedList.Add(Dependency);
+					Context.ComponentStack.Add(Dependency);
+				}
+			}
+		}
+
+		// reset only visited bits, so that context can be reused for the next root
+		for (const int32 Visited: Context.VisitedList)
+		{
+			Context.VisitedComponents[Visited] = false;
+		}
+		Context.VisitedList.Reset();
+
+		// each root is audited by a single task, so writing to a node is safe
+		FAssetNode& RootNode = Nodes[RootIndex];
+		FAssetAuditResult& Result = RootNode.AuditResult;
+		Result.AssetData = RootNode.AssetData;
+		Result.TotalDiskSizeBytes = static_cast<float>(DiskSizeBytes);
+		Result.TotalMemorySizeBytes = static_cast<float>(MemorySizeBytes);
+		Result.InclusiveDiskSizeBytes = static_cast<float>(RootNode.InclusiveDiskSizeBytes);
+		Result.InclusiveMemorySizeBytes = static_cast<float>(RootNode.InclusiveMemorySizeBytes);
+		Result.TotalDependencyCount = NumNodes - 1;
+		Result.MaxDependencyBreadth = RootNode.MaxDependencyBreadth;
+		Result.DependencyDepth = RootNode.DependencyDepth;
+		
+		RootNode.bAuditResultValid = true;
+	});
+}
+
+void FAssetDependencyTree::InvalidateNode(FNodeIndex NodeIndex, bool bInvalidateDependencies)
+{
+	FAssetNode& Node = Nodes[NodeIndex];
+	Node.bSizeValid = false;
+	Node.bDependenciesValid &= !bInvalidateDependencies;
+
+	// memoized data of a node is only valid if it is valid for every dependency,
+	// so propagation can stop at referencers that are already invalidated
+	TArray<FNodeIndex, TInlineAllocator<64>> NodeStack{NodeIndex};
+	while (!NodeStack.IsEmpty())
+	{
+		FAssetNode& Current = Nodes[NodeStack.Pop()];
+		Current.bAggregateValid = false;
+		Current.bAuditResultValid = false;
+
+		for (const FNodeIndex Referencer: Current.Referencers)
+		{
+			if (Nodes[Referencer].bAggregateValid)
+			{
+				NodeStack.Add(Referencer);
+			}
+		}
+	}
+}
+
+void FAssetDependencyTree::RemoveNode(FNodeIndex NodeIndex)
+{
+	InvalidateNode(NodeIndex, true);
+
+	FAssetNode& Node = Nodes[NodeIndex];
+	for (const FNodeIndex Referencer: Node.Referencers)
+	{
+		Nodes[Referencer].Dependencies.RemoveSwap(NodeIndex);
+		Nodes[Referencer].bDependenciesValid = false;
+	}
+	for (const FNodeIndex Dependency: Node.Dependencies)
+	{
+		Nodes[Dependency].Referencers.RemoveSwap(NodeIndex);
+	}
+
+	NodeIndices.Remove(Node.AssetData.PackageName);
+	Node = FAssetNode{};
+	FreeNodes.Add(NodeIndex);
+}
 
-	OutResult.DependencyDepth = FMath::Max(OutResult.DependencyDepth, CurrentDepth);
-	OutResult.MaxDependencyBreadth = FMath::Max(OutResult.MaxDependencyBreadth, TreeNode->Children.Num());
-	OutResult.TotalDependencyCount += TreeNode->Children.Num();
+void FAssetDependencyTree::HandleAssetAdded(const FAssetData& AssetData)
+{
+	HandlePackageChanged(AssetData.PackageName, false);
+}
+
+void FAssetDependencyTree::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	HandlePackageChanged(AssetData.PackageName, true);
+}
+
+void FAssetDependencyTree::HandleAssetUpdated(const FAssetData& AssetData)
+{
+	HandlePackageChanged(AssetData.PackageName, false);
+}
+
+void FAssetDependencyTree::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	HandlePackageChanged(FName{FPackageName::ObjectPathToPackageName(OldObjectPath)}, true);
+	HandlePackageChanged(AssetData.PackageName, false);
+}
+
+void FAssetDependencyTree::HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	// disk and memory size of a package may change without asset registry update
+	HandlePackageChanged(Package->GetFName(), false);
+}
+
+void FAssetDependencyTree::HandlePackageChanged(FName PackageName, bool bRemoved)
+{
+	FScopeLock Lock{&CriticalSection};
+	if (NodeIndices.IsEmpty())
+	{
+		// nothing to invalidate, don't query asset registry while it is still discovering assets
+		return;
+	}
 	
-	for (const TSharedPtr<FAssetTreeNode>& Child: TreeNode->Children)
+	if (bAuditInProgress)
 	{
-		AuditAsset(Child, OutResult, CurrentDepth + 1);
+		bool& bPendingRemoved = PendingChanges.FindOrAdd(PackageName, false);
+		bPendingRemoved |= bRemoved;
+		return;
+	}
+
+	if (bRemoved)
+	{
+		if (const FNodeIndex* NodeIndex = NodeIndices.Find(PackageName))
+		{
+			RemoveNode(*NodeIndex);
+		}
+	}
+	else
+	{
+		InvalidatePackageWithReferencers(PackageName);
 	}
 }
 
+void FAssetDependencyTree::ApplyPendingChanges()
+{
+	TMap<FName, bool> Changes = MoveTemp(PendingChanges);
+	for (const TPair<FName, bool>& Change: Changes)
+	{
+		HandlePackageChanged(Change.Key, Change.Value);
+	}
+}
+
+void FAssetDependencyTree::InvalidatePackageWithReferencers(FName PackageName)
+{
+	if (const FNodeIndex* NodeIndex = NodeIndices.Find(PackageName))
+	{
+		InvalidateNode(*NodeIndex, true);
+	}
+
+	// referencers may have skipped the package if it wasn't known to asset registry when their dependencies were resolved
+	TArray<FName> Referencers;
+	IAssetRegistry::GetChecked().GetReferencers(PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+	for (FName Referencer: Referencers)
+	{
+		if (const FNodeIndex* NodeIndex = NodeIndices.Find(Referencer))
+		{
+			InvalidateNode(*NodeIndex, true);
+		}
+	}
+}
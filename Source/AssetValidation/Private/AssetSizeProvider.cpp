@@ -0,0 +1,177 @@
+#include "AssetSizeProvider.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetValidationSettings.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "UObject/UObjectHash.h"
+
+namespace UE::AssetValidation
+{
+/** Increment to discard size cache written by previous versions */
+static constexpr int32 AssetSizeCacheVersion = 1;
+
+FAssetSizeProvider::FAssetSizeProvider()
+{
+	if (UAssetValidationSettings::Get()->bUseAssetSizeCache)
+	{
+		LoadCache();
+	}
+}
+
+FAssetSizeProvider::~FAssetSizeProvider()
+{
+	SaveCache();
+}
+
+bool FAssetSizeProvider::GetAssetSizeBytes(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, float& OutMemorySize, float& OutDiskSize)
+{
+	OutMemorySize = OutDiskSize = 0.f;
+	if (!AssetData.IsValid())
+	{
+		return false;
+	}
+
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName);
+	if (PackageData.IsSet())
+	{
+		OutDiskSize = PackageData->DiskSize;
+	}
+
+	const UAssetValidationSettings* Settings = UAssetValidationSettings::Get();
+	for (const FName& Tag: Settings->MemorySizeAssetTags)
+	{
+		if (int64 TagSize = 0; AssetData.GetTagValue(Tag, TagSize) && TagSize > 0)
+		{
+			OutMemorySize = TagSize;
+			return true;
+		}
+	}
+
+	if (UObject* Asset = AssetData.FastGetAsset(false))
+	{
+		// asset is already loaded, no reason to use cache
+		OutMemorySize = Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		return true;
+	}
+
+	const bool bUseCache = Settings->bUseAssetSizeCache && PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero();
+	if (bUseCache)
+	{
+		if (const FSizeRecord* Record = SizeCache.Find(AssetData.PackageName); Record && Record->PackageHash == PackageData->GetPackageSavedHash())
+		{
+			OutMemorySize = Record->MemorySizeBytes;
+			return true;
+		}
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetSizeProvider::LoadAsset, AssetValidationChannel);
+
+	// only packages loaded for size estimation are unloaded later
+	const bool bPackageLoaded = FindPackage(nullptr, *AssetData.PackageName.ToString()) != nullptr;
+	if (UObject* Asset = AssetData.GetAsset())
+	{
+		if (!bPackageLoaded)
+		{
+			LoadedPackages.Add(Asset->GetPackage());
+		}
+
+		const int64 MemorySize = Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		OutMemorySize = MemorySize;
+
+		if (bUseCache && !Asset->GetPackage()->IsDirty())
+		{
+			SizeCache.Add(AssetData.PackageName, FSizeRecord{PackageData->GetPackageSavedHash(), MemorySize});
+			bCacheDirty = true;
+		}
+	}
+
+	return true;
+}
+
+void FAssetSizeProvider::UnloadAssets()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FAssetSizeProvider::UnloadAssets, AssetValidationChannel);
+	check(IsInGameThread());
+
+	int32 NumPackages = 0;
+	for (const TWeakObjectPtr<UPackage>& WeakPackage: LoadedPackages)
+	{
+		UPackage* Package = WeakPackage.Get();
+		// keep packages that were modified while they were loaded, worlds require cleanup before they can be unloaded
+		if (Package == nullptr || Package->IsDirty() || Package->ContainsMap())
+		{
+			continue;
+		}
+
+		// standalone assets survive garbage collection with default keep flags
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		}, false);
+		++NumPackages;
+	}
+	LoadedPackages.Reset();
+
+	if (NumPackages > 0)
+	{
+		UE_LOG(LogAssetValidation, Verbose, TEXT("AssetSizeProvider: unloading %d packages loaded for size estimation."), NumPackages);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	SaveCache();
+}
+
+void FAssetSizeProvider::SaveCache()
+{
+	if (!bCacheDirty)
+	{
+		return;
+	}
+
+	bCacheDirty = false;
+
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Writer{IFileManager::Get().CreateFileWriter(*Filename)})
+	{
+		// file archives don't serialize names, write them as strings
+		FNameAsStringProxyArchive Ar{*Writer};
+		int32 Version = AssetSizeCacheVersion;
+		Ar << Version;
+		Ar << SizeCache;
+	}
+	else
+	{
+		UE_LOG(LogAssetValidation, Warning, TEXT("AssetSizeProvider: failed to write size cache to %s"), *Filename);
+	}
+}
+
+void FAssetSizeProvider::LoadCache()
+{
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Reader{IFileManager::Get().CreateFileReader(*Filename)})
+	{
+		FNameAsStringProxyArchive Ar{*Reader};
+		int32 Version = 0;
+		Ar << Version;
+		if (Version == AssetSizeCacheVersion)
+		{
+			Ar << SizeCache;
+		}
+
+		if (Ar.IsError())
+		{
+			SizeCache.Reset();
+		}
+	}
+}
+
+FString FAssetSizeProvider::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetValidation") / TEXT("AssetSizeCache.bin");
+}
+
+} // UE::AssetValidation
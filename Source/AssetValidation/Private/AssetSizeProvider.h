@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+
+class IAssetRegistry;
+class UPackage;
+struct FAssetData;
+
+namespace UE::AssetValidation
+{
+/**
+ * Asset Size Provider
+ * Estimates asset memory size for asset audits without loading assets whenever possible. Sources are queried in order:
+ *  - AssetRegistry tags listed in UAssetValidationSettings::MemorySizeAssetTags
+ *  - Resource size of an already loaded asset
+ *  - Persistent size cache, keyed by package saved hash
+ *  - Resource size of a loaded asset, asset is loaded for measurement and unloaded later by UnloadAssets
+ * Disk size is always read from asset package data
+ */
+class FAssetSizeProvider
+{
+public:
+	FAssetSizeProvider();
+	~FAssetSizeProvider();
+
+	FAssetSizeProvider(const FAssetSizeProvider&) = delete;
+	FAssetSizeProvider& operator=(const FAssetSizeProvider&) = delete;
+
+	/** @return true if asset data is valid. Sizes that can't be estimated are set to zero */
+	bool GetAssetSizeBytes(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, float& OutMemorySize, float& OutDiskSize);
+
+	/** @return number of assets loaded for size estimation since last UnloadAssets call */
+	FORCEINLINE int32 GetNumLoadedAssets() const { return LoadedPackages.Num(); }
+
+	/**
+	 * Unload packages loaded for size estimation by clearing RF_Standalone on their objects and running garbage collection, save size cache.
+	 * Packages that were already in memory or modified since loading are kept.
+	 * Caller is responsible for ensuring that no one holds unreferenced pointers to loaded objects
+	 */
+	void UnloadAssets();
+
+	/** Write size cache to disk, if it has changed */
+	void SaveCache();
+
+private:
+	struct FSizeRecord
+	{
+		FIoHash PackageHash;
+		int64 MemorySizeBytes = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FSizeRecord& Record)
+		{
+			Ar << Record.PackageHash;
+			Ar << Record.MemorySizeBytes;
+			return Ar;
+		}
+	};
+
+	void LoadCache();
+	static FString GetCacheFilename();
+
+	/** persistent memory size cache, keyed by package name */
+	TMap<FName, FSizeRecord> SizeCache;
+	/** packages loaded for size estimation since last UnloadAssets call */
+	TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+	bool bCacheDirty = false;
+};
+
+} // UE::AssetValidation
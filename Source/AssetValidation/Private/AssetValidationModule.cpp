@@ -2,15 +2,18 @@
 
 #include "AssetValidationModule.h"
 
+#include "AssetDependencyTree.h"
 #include "AssetValidationSettings.h"
 #include "AssetValidationStatics.h"
 #include "AssetValidationStyle.h"
 #include "ISettingsModule.h"
 #include "ISourceControlModule.h"
 #include "ISourceControlProvider.h"
+#include "PackageLoadJournal.h"
 #include "PropertyExtensionTypes.h"
 #include "PropertyValidationSettings.h"
 #include "SourceControlProxy.h"
+#include "ValidationResultCache.h"
 #include "Misc/MessageDialog.h"
 #include "ToolMenus.h"
 #include "UnrealEdGlobals.h"
@@ -105,6 +108,9 @@ void FAssetValidationModule::UpdateSourceControlProxy(ISourceControlProvider& Ol
 void FAssetValidationModule::StartupModule()
 {
 	FAssetValidationStyle::Initialize();
+	UE::AssetValidation::FScopedLogCapture::Initialize();
+	UE::AssetValidation::FPackageLoadJournal::Initialize();
+	UE::AssetValidation::FDataTableRowCache::Initialize();
 	
 	if (FSlateApplication::IsInitialized())
 	{
@@ -142,6 +148,10 @@ void FAssetValidationModule::ShutdownModule()
 	// we call this function before unloading the module.
 	FEditorDelegates::OnEditorInitialized.RemoveAll(this);
 	
+	FAssetDependencyTree::Shutdown();
+	UE::AssetValidation::FDataTableRowCache::Shutdown();
+	UE::AssetValidation::FPackageLoadJournal::Shutdown();
+	UE::AssetValidation::FScopedLogCapture::Shutdown();
 	FAssetValidationStyle::Shutdown();
 	
 	ISourceControlModule& SourceControl = ISourceControlModule::Get();
@@ -22,117 +22,235 @@
 #include "Misc/UObjectToken.h"
 #include "Presentation/MessageLogListingViewModel.h"
 
+#include <atomic>
+
 #define LOCTEXT_NAMESPACE "AssetValidation"
 
 namespace UE::AssetValidation
 {
-	
-FScopedAssetContext::FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext)
-	: FOutputDevice()
-    , AssetData(InAssetData)
-    , Context(InContext)
+
+/**
+ * Per-thread storage for captured log messages. Only the owning thread reads and writes it, so it doesn't need any locks.
+ * Buffers are reused between capture scopes: when scope ends, messages it captured are discarded by resetting the counters
+ */
+struct FThreadLogCapture
 {
-    GLog->AddOutputDevice(this);
-}
+	struct FCapturedMessage
+	{
+		int32 TextOffset = 0;
+		int32 TextLength = 0;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Warning;
+	};
 
-FScopedAssetContext::FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext, TFunction<FString(const FString&)> InLogConverter)
-	: FScopedAssetContext(InAssetData, InContext)
+	void Add(const TCHAR* V, ELogVerbosity::Type Verbosity)
+	{
+		const int32 Length = FCString::Strlen(V);
+		if (TextLength + Length > Text.Num())
+		{
+			Text.AddUninitialized(FMath::Max(Length, Text.Num()));
+		}
+		FMemory::Memcpy(Text.GetData() + TextLength, V, Length * sizeof(TCHAR));
+
+		if (NumMessages == Messages.Num())
+		{
+			Messages.AddUninitialized(FMath::Max(16, Messages.Num()));
+		}
+		Messages[NumMessages++] = FCapturedMessage{TextLength, Length, Verbosity};
+		TextLength += Length;
+	}
+
+	/** innermost capture scope active on this thread */
+	FScopedLogCapture* ActiveScope = nullptr;
+	TArray<FCapturedMessage> Messages;
+	TArray<TCHAR> Text;
+	int32 NumMessages = 0;
+	int32 TextLength = 0;
+};
+
+static thread_local FThreadLogCapture ThreadLogCapture;
+/** storage for process wide capture scopes, which are opened on the game thread but capture messages from any thread */
+static FThreadLogCapture ProcessLogCapture;
+static FCriticalSection ProcessLogCaptureLock;
+/** innermost process wide capture scope, can be checked without acquiring the lock */
+static std::atomic<FScopedLogCapture*> ActiveProcessScope{nullptr};
+
+/**
+ * Routes warnings and errors to a capture scope. Output devices that can be used on multiple threads are called on the emitting thread,
+ * so messages go to the innermost scope of the emitting thread if it has one, otherwise to the innermost process wide scope
+ */
+class FLogCaptureOutputDevice: public FOutputDevice
 {
-	LogConverter = InLogConverter;
+public:
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+	{
+		Verbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+		if (Verbosity == ELogVerbosity::NoLogging || Verbosity > ELogVerbosity::Warning)
+		{
+			return;
+		}
+
+		const FScopedLogCapture* ThreadScope = ThreadLogCapture.ActiveScope;
+		if (ThreadScope != nullptr && !ThreadScope->IsProcessWide())
+		{
+			ThreadLogCapture.Add(V, Verbosity);
+		}
+		else if (ThreadScope != nullptr || ActiveProcessScope.load(std::memory_order_relaxed) != nullptr)
+		{
+			FScopeLock Lock{&ProcessLogCaptureLock};
+			if (ProcessLogCapture.ActiveScope != nullptr)
+			{
+				ProcessLogCapture.Add(V, Verbosity);
+			}
+		}
+	}
+};
+
+static FLogCaptureOutputDevice LogCaptureOutputDevice;
+
+void FScopedLogCapture::Initialize()
+{
+	GLog->AddOutputDevice(&LogCaptureOutputDevice);
 }
 
-FScopedAssetContext::~FScopedAssetContext()
+void FScopedLogCapture::Shutdown()
 {
-	// we do not need to lock our critical section, as FOutputDeviceRedirectorState holds a Read Lock before calling Serialize,
-	// and RemoveOutputDevice tries to acquire a Write Lock from the same state. So if we lock ourselves here it will cause a deadlock
-    GLog->RemoveOutputDevice(this);
+	GLog->RemoveOutputDevice(&LogCaptureOutputDevice);
 }
 
-void FScopedAssetContext::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+FScopedLogCapture::FScopedLogCapture(bool bInEnabled, ELogCaptureScope Scope)
+	: bCapturing(bInEnabled)
+	// messages from other threads can be attributed to a scope only while game thread waits for them, e.g. for package loading
+	, bProcessWide(Scope == ELogCaptureScope::Process && IsInGameThread())
 {
-	if (Verbosity > ELogVerbosity::Warning)
+	if (!bCapturing)
 	{
 		return;
 	}
 	
-    std::scoped_lock Lock{CriticalSection};
-
-	FString Message{V};
-	if (LogConverter)
+	FThreadLogCapture& ThreadCapture = ThreadLogCapture;
+	PreviousScope = ThreadCapture.ActiveScope;
+	ThreadCapture.ActiveScope = this;
+	
+	if (bProcessWide)
 	{
-		Message = LogConverter(Message);
+		FScopeLock Lock{&ProcessLogCaptureLock};
+		PreviousProcessScope = ProcessLogCapture.ActiveScope;
+		FirstMessage = ProcessLogCapture.NumMessages;
+		ProcessLogCapture.ActiveScope = this;
+		ActiveProcessScope.store(this, std::memory_order_relaxed);
 	}
-	
-    const FText MessageText = FText::FromString(Message);
-    switch (Verbosity)
-    {
-    case ELogVerbosity::Warning:
-    	Context.AddMessage(AssetData, EMessageSeverity::Warning, MessageText);
-    	break;
-    case ELogVerbosity::Error:
-    	Context.AddMessage(AssetData, EMessageSeverity::Error, MessageText);
-    	break;
-    default:
-    	break;
-    }
-}
-
-FScopedLogMessageGatherer::FScopedLogMessageGatherer(bool bInEnabled)
-	: bEnabled(bInEnabled)
-{
-	if (bEnabled)
+	else
 	{
-		GLog->AddOutputDevice(this);
+		FirstMessage = ThreadCapture.NumMessages;
 	}
-	
 }
 
-FScopedLogMessageGatherer::~FScopedLogMessageGatherer()
+FScopedLogCapture::~FScopedLogCapture()
 {
-	if (bEnabled)
-	{
-		// we do not need to lock our critical section, as FOutputDeviceRedirectorState holds a Read Lock before calling Serialize,
-		// and RemoveOutputDevice tries to acquire a Write Lock from the same state. So if we lock ourselves here it will cause a deadlock
-		GLog->RemoveOutputDevice(this);
-	}
+	StopCapture([](FString&&, ELogVerbosity::Type) {});
 }
 
-void FScopedLogMessageGatherer::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+void FScopedLogCapture::StopCapture(TFunctionRef<void(FString&& Message, ELogVerbosity::Type Verbosity)> Callback)
 {
-	if (!bEnabled)
+	if (!bCapturing)
 	{
 		return;
 	}
-	
-	if (Verbosity > ELogVerbosity::Warning)
+
+	FThreadLogCapture& ThreadCapture = ThreadLogCapture;
+	// capture scopes should be strictly nested and can't be moved between threads
+	check(ThreadCapture.ActiveScope == this);
+
+	ThreadCapture.ActiveScope = PreviousScope;
+	bCapturing = false;
+
+	TArray<TPair<FString, ELogVerbosity::Type>, TInlineAllocator<8>> CapturedMessages;
+	auto ExtractMessages = [this, &CapturedMessages](FThreadLogCapture& Capture)
 	{
-		return;
+		if (Capture.NumMessages == FirstMessage)
+		{
+			return;
+		}
+		
+		for (int32 Index = FirstMessage; Index < Capture.NumMessages; ++Index)
+		{
+			const FThreadLogCapture::FCapturedMessage& Message = Capture.Messages[Index];
+			CapturedMessages.Emplace(FString{FStringView{Capture.Text.GetData() + Message.TextOffset, Message.TextLength}}, Message.Verbosity);
+		}
+
+		// discard messages captured by this scope before handling them, callback may log messages to the previous scope
+		Capture.TextLength = Capture.Messages[FirstMessage].TextOffset;
+		Capture.NumMessages = FirstMessage;
+	};
+
+	if (bProcessWide)
+	{
+		FScopeLock Lock{&ProcessLogCaptureLock};
+		check(ProcessLogCapture.ActiveScope == this);
+		
+		ProcessLogCapture.ActiveScope = PreviousProcessScope;
+		ActiveProcessScope.store(PreviousProcessScope, std::memory_order_relaxed);
+		ExtractMessages(ProcessLogCapture);
+	}
+	else
+	{
+		ExtractMessages(ThreadCapture);
 	}
 
-	std::scoped_lock Lock{CriticalSection};
-	switch (Verbosity)
+	for (auto& [Message, Verbosity]: CapturedMessages)
 	{
-	case ELogVerbosity::Warning:
-		Warnings.Add(FString{V});
-		break;
-	case ELogVerbosity::Error:
-		Errors.Add(FString{V});
-		break;
-	default:
-		break;
+		Callback(MoveTemp(Message), Verbosity);
 	}
 }
 
-void FScopedLogMessageGatherer::Stop(TArray<FString>& OutWarnings, TArray<FString>& OutErrors)
+FScopedAssetContext::FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext)
+	: FScopedLogCapture()
+	, AssetData(InAssetData)
+	, Context(InContext)
+{
+
+}
+
+FScopedAssetContext::FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext, TFunction<FString(const FString&)> InLogConverter)
+	: FScopedAssetContext(InAssetData, InContext)
+{
+	LogConverter = InLogConverter;
+}
+
+FScopedAssetContext::~FScopedAssetContext()
 {
-	if (!bEnabled)
+	StopCapture([this](FString&& Message, ELogVerbosity::Type Verbosity)
 	{
-		return;
-	}
+		if (LogConverter)
+		{
+			Message = LogConverter(Message);
+		}
+
+		const EMessageSeverity::Type Severity = Verbosity == ELogVerbosity::Warning ? EMessageSeverity::Warning : EMessageSeverity::Error;
+		Context.AddMessage(AssetData, Severity, FText::FromString(MoveTemp(Message)));
+	});
+}
+
+FScopedLogMessageGatherer::FScopedLogMessageGatherer(bool bInEnabled, ELogCaptureScope Scope)
+	: FScopedLogCapture(bInEnabled, Scope)
+{
 	
-	std::scoped_lock Lock{CriticalSection};
-	OutWarnings = MoveTemp(Warnings);
-	OutErrors = MoveTemp(Errors);
+}
+
+void FScopedLogMessageGatherer::Stop(TArray<FString>& OutWarnings, TArray<FString>& OutErrors)
+{
+	StopCapture([&OutWarnings, &OutErrors](FString&& Message, ELogVerbosity::Type Verbosity)
+	{
+		if (Verbosity == ELogVerbosity::Warning)
+		{
+			OutWarnings.Add(MoveTemp(Message));
+		}
+		else
+		{
+			OutErrors.Add(MoveTemp(Message));
+		}
+	});
 }
 } // UE::AssetValidation
 
@@ -445,6 +563,29 @@ namespace UE::AssetValidation
 		AppendMessages(ValidationContext, AssetData, EMessageSeverity::Warning, Warnings);
 	}
 
+	void AppendMessages(FDataValidationContext& Target, const FDataValidationContext& Source)
+	{
+		for (const FDataValidationContext::FIssue& Issue : Source.GetIssues())
+		{
+			if (Issue.TokenizedMessage.IsValid())
+			{
+				Target.AddMessage(Issue.TokenizedMessage.ToSharedRef());
+			}
+			else if (Issue.Severity == EMessageSeverity::Error)
+			{
+				Target.AddError(Issue.Message);
+			}
+			else if (Issue.Severity == EMessageSeverity::Warning)
+			{
+				Target.AddWarning(Issue.Message);
+			}
+			else
+			{
+				Target.AddMessage(Issue.Severity, Issue.Message);
+			}
+		}
+	}
+
 	void AppendMessages(FDataValidationContext& ValidationContext, const FAssetData& AssetData, EMessageSeverity::Type Severity, TConstArrayView<FText> Messages)
 	{
 		for (const FText& Msg: Messages)
@@ -554,6 +695,19 @@ namespace UE::AssetValidation
 		return IsExternalAsset(AssetData.PackagePath.ToString());
 	}
 
+	bool MentionsPackage(const FString& Message, const FString& PackageName)
+	{
+		for (int32 Index = Message.Find(PackageName); Index != INDEX_NONE; Index = Message.Find(PackageName, ESearchCase::IgnoreCase, ESearchDir::FromStart, Index + 1))
+		{
+			const int32 End = Index + PackageName.Len();
+			if (End == Message.Len() || !(FChar::IsAlnum(Message[End]) || Message[End] == TEXT('_') || Message[End] == TEXT('/')))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 namespace Private
 {
 	template <>
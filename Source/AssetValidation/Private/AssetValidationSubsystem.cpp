@@ -10,12 +10,16 @@
 #include "ISourceControlModule.h"
 #include "ISourceControlProvider.h"
 #include "SourceControlProxy.h"
+#include "ValidationResultCache.h"
 #include "Algo/RemoveIf.h"
 #include "AssetRegistry/AssetDataToken.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "AssetValidators/AssetValidator.h"
+#include "Async/ParallelFor.h"
 #include "Misc/DataValidation.h"
 #include "Misc/ScopedSlowTask.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
 
 #define LOCTEXT_NAMESPACE "AssetValidation"
 
@@ -23,6 +27,106 @@ static_assert(static_cast<uint8>(EDataValidationResult::Invalid)		== 0);
 static_assert(static_cast<uint8>(EDataValidationResult::Valid)			== 1);
 static_assert(static_cast<uint8>(EDataValidationResult::NotValidated)	== 2);
 
+namespace UE::AssetValidation
+{
+	/** Asset that finished serial validation and waits for parallel validators to complete */
+	struct FPendingAssetValidation
+	{
+		FPendingAssetValidation(const FAssetData& InAssetData, TConstArrayView<FAssetData> InExternalObjects, bool bAlreadyLoaded, EDataValidationUsecase Usecase)
+			: AssetData(InAssetData)
+			, ExternalObjects(InExternalObjects)
+			, Context(MakeUnique<FDataValidationContext>(!bAlreadyLoaded, Usecase, InExternalObjects))
+			, bWasAssetLoadedForValidation(!bAlreadyLoaded)
+		{}
+		
+		FAssetData AssetData;
+		TConstArrayView<FAssetData> ExternalObjects;
+		/** validation context is allocated separately, as it is not movable */
+		TUniquePtr<FDataValidationContext> Context;
+		EDataValidationResult Result = EDataValidationResult::NotValidated;
+		/** validation cache key, zero if validation result can't be cached */
+		FIoHash CacheKey;
+		bool bWasAssetLoadedForValidation = false;
+		/** false if asset was skipped by serial validation, e.g. it has been already validated as a part of this request */
+		bool bValidated = false;
+		/** true if validation result was replayed from validation cache */
+		bool bCachedResult = false;
+	};
+
+	/**
+	 * Asset Prefetcher
+	 * Requests async loading of upcoming packages, so that package loading overlaps with validation of the current batch.
+	 * Prefetched assets are kept alive until they're validated or skipped, so that memory trimming doesn't unload them in advance.
+	 * Outstanding requests are not waited for on destruction, assets loaded by them are collected by the next garbage collection
+	 */
+	class FAssetPrefetcher
+	{
+	public:
+		/** Request async load for an asset package, if it is not loaded yet */
+		void Prefetch(const FAssetData& AssetData)
+		{
+			if (State->PrefetchedPackages.Contains(AssetData.PackageName) || AssetData.FastGetAsset(false) != nullptr)
+			{
+				return;
+			}
+
+			State->PrefetchedPackages.Add(AssetData.PackageName);
+			LoadPackageAsync(AssetData.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+			[WeakState = State.ToWeakPtr(), ObjectPath = AssetData.ToSoftObjectPath()](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+			{
+				// don't keep asset alive if it was released while its package was loading
+				TSharedPtr<FPrefetchState> PinnedState = WeakState.Pin();
+				if (PinnedState.IsValid() && PinnedState->PrefetchedPackages.Contains(PackageName) && Package != nullptr && Result == EAsyncLoadingResult::Succeeded)
+				{
+					if (UObject* Asset = ObjectPath.ResolveObject())
+					{
+						PinnedState->LoadedAssets.Add(PackageName, TStrongObjectPtr<UObject>{Asset});
+					}
+				}
+			}));
+		}
+
+		/** @return true if package was requested by prefetcher and hasn't been released yet */
+		bool IsPrefetched(FName PackageName) const
+		{
+			return State->PrefetchedPackages.Contains(PackageName);
+		}
+
+		/**
+		 * Release prefetched asset once it is validated or skipped by validation
+		 * @return true if package was requested by prefetcher
+		 */
+		bool Release(FName PackageName)
+		{
+			if (State->PrefetchedPackages.Remove(PackageName) > 0)
+			{
+				State->LoadedAssets.Remove(PackageName);
+				return true;
+			}
+			return false;
+		}
+
+		/** Release every prefetched asset, e.g. when validation is canceled */
+		void ReleaseAll()
+		{
+			State->PrefetchedPackages.Reset();
+			State->LoadedAssets.Reset();
+		}
+
+	private:
+		struct FPrefetchState
+		{
+			/** packages requested by prefetcher and not released yet */
+			TSet<FName> PrefetchedPackages;
+			/** assets loaded by prefetch requests */
+			TMap<FName, TStrongObjectPtr<UObject>> LoadedAssets;
+		};
+		
+		/** prefetch state, shared with load callbacks that may outlive the prefetcher */
+		TSharedRef<FPrefetchState> State = MakeShared<FPrefetchState>();
+	};
+}
+
 UAssetValidationSubsystem::UAssetValidationSubsystem()
 {
 }
@@ -52,6 +156,8 @@ void UAssetValidationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UAssetValidationSubsystem::Deinitialize()
 {
 	ActorValidators.Empty();
+	// save validation cache and unbind from asset registry events
+	ValidationCache.Reset();
 	
 	Super::Deinitialize();
 }
@@ -315,9 +421,119 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 	OutResults.NumRequested = AssetDataList.Num();
 
 	const auto& UserSettings = UAssetValidationSettings::Get();
+
+	// ASSET VALIDATION BEGIN reuse validation results of unchanged assets
+	UE::AssetValidation::FValidationResultCache* ResultCache = nullptr;
+	if (ShouldUseValidationCache(InSettings))
+	{
+		if (!ValidationCache.IsValid())
+		{
+			ValidationCache = MakeShared<UE::AssetValidation::FValidationResultCache>();
+		}
+		ResultCache = ValidationCache.Get();
+		// deferred validators are not reported as enabled, but they're a part of the validator set.
+		// Validator set is hashed before this request defers its parallel validators, validators deferred by an outer request are restored temporarily
+		SetValidatorsDeferred(false);
+		ResultCache->BeginRequest(*this, InSettings);
+		SetValidatorsDeferred(true);
+	}
+	// ASSET VALIDATION END
+
+	// ASSET VALIDATION BEGIN run parallel safe validators on worker threads for batches of assets
+	TArray<UAssetValidator*> ParallelValidators;
+	if (ShouldRunParallelValidation(InSettings))
+	{
+		GatherParallelValidators(InSettings.ValidationUsecase, ParallelValidators);
+	}
+	
+	// defer parallel validators, so that serial validation doesn't run them
+	TGuardValue DeferredValidatorsGuard{DeferredValidators, ParallelValidators};
+	SetValidatorsDeferred(true);
+	ON_SCOPE_EXIT
+	{
+		SetValidatorsDeferred(false);
+	};
+
+	const int32 BatchSize = ParallelValidators.IsEmpty() ? 1 : FMath::Max(1, UserSettings->ParallelValidationBatchSize);
+	TArray<UE::AssetValidation::FPendingAssetValidation> PendingAssets;
+	PendingAssets.Reserve(BatchSize);
+	// ASSET VALIDATION END
+
+	// ASSET VALIDATION BEGIN reuse validation results of unchanged assets
+	// cache keys are computed once, as they're used both by prefetching and validation
+	TArray<FIoHash> CacheKeys;
+	TBitArray<> CacheKeysValid{false, ResultCache ? AssetDataList.Num() : 0};
+	CacheKeys.SetNum(CacheKeysValid.Num());
+	
+	auto GetCacheKey = [&](int32 AssetIndex) -> const FIoHash&
+	{
+		if (!CacheKeysValid[AssetIndex])
+		{
+			const FAssetData& AssetData = AssetDataList[AssetIndex];
+			TConstArrayView<FAssetData> ExternalObjects;
+			if (const TArray<FAssetData>* ExternalObjectsPtr = AssetsToExternalObjects.Find(AssetData))
+			{
+				ExternalObjects = *ExternalObjectsPtr;
+			}
+			
+			CacheKeys[AssetIndex] = ResultCache->GetAssetKey(AssetRegistry, AssetData, ExternalObjects);
+			CacheKeysValid[AssetIndex] = true;
+		}
+		return CacheKeys[AssetIndex];
+	};
+	// ASSET VALIDATION END
+
+	// ASSET VALIDATION BEGIN prefetch upcoming assets and unload validated assets once memory high water mark is reached
+	TOptional<UE::AssetValidation::FAssetPrefetcher> Prefetcher;
+	if (ShouldPrefetchAssets(InSettings))
+	{
+		Prefetcher.Emplace();
+	}
+	TGuardValue PrefetcherGuard{AssetPrefetcher, Prefetcher.GetPtrOrNull()};
+	int32 PrefetchIndex = 0;
+
+	// release prefetched asset as soon as validation skips it, validated assets are released by IsAssetValidWithContext
+	auto ReleasePrefetchedAsset = [&Prefetcher](const FAssetData& AssetData)
+	{
+		if (Prefetcher.IsSet())
+		{
+			Prefetcher->Release(AssetData.PackageName);
+		}
+	};
+
+	// packages loaded by this validation request, the only ones that memory trimming is allowed to unload
+	TArray<TWeakObjectPtr<UPackage>> PackagesLoadedForValidation;
+
+	auto FinishBatch = [&]
+	{
+		ValidateAssetsParallel(PendingAssets, ParallelValidators);
+		FinishPendingAssets(DataValidationLog, PendingAssets, InSettings, OutResults);
+		
+		for (const UE::AssetValidation::FPendingAssetValidation& PendingAsset: PendingAssets)
+		{
+			if (PendingAsset.bWasAssetLoadedForValidation && !PendingAsset.bCachedResult)
+			{
+				if (const UObject* Asset = PendingAsset.AssetData.FastGetAsset(false))
+				{
+					PackagesLoadedForValidation.Add(Asset->GetPackage());
+				}
+			}
+		}
+		PendingAssets.Reset();
+		
+		// pending assets are reset, no one holds pointers to validated assets
+		if (ShouldTrimMemory(InSettings))
+		{
+			TrimMemory(PackagesLoadedForValidation);
+			PackagesLoadedForValidation.Reset();
+		}
+	};
+	// ASSET VALIDATION END
+	
 	// Now add to map or update as needed
-	for (const FAssetData& AssetData : AssetDataList)
+	for (int32 AssetIndex = 0; AssetIndex < AssetDataList.Num(); ++AssetIndex)
 	{
+		const FAssetData& AssetData = AssetDataList[AssetIndex];
 		ensure(AssetData.IsValid());
 
 		if (SlowTask.ShouldCancel())
@@ -328,15 +544,35 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 		
 		SlowTask.EnterProgressFrame(1.0f, FText::Format(LOCTEXT("ValidatingFilename", "Validating {0}"), FText::FromString(AssetData.GetFullName())));
 		
-		if (OutResults.NumChecked >= InSettings.MaxAssetsToValidate)
+		// ASSET VALIDATION BEGIN account for assets pending parallel validation
+		if (OutResults.NumChecked + PendingAssets.Num() >= InSettings.MaxAssetsToValidate)
+		// ASSET VALIDATION END
 		{
 			OutResults.bAssetLimitReached = true;
 			DataValidationLog.Info(FText::Format(LOCTEXT("AssetLimitReached", "MaxAssetsToValidate count {0} reached."), InSettings.MaxAssetsToValidate));
 			break;
 		}
 
+		// ASSET VALIDATION BEGIN keep prefetch window ahead of the current asset, don't prefetch past MaxAssetsToValidate
+		if (Prefetcher.IsSet())
+		{
+			const int32 NumAssetsLeft = InSettings.MaxAssetsToValidate - (OutResults.NumChecked + PendingAssets.Num() + 1);
+			const int32 PrefetchEnd = FMath::Min(AssetDataList.Num(), AssetIndex + 1 + FMath::Min(UserSettings->NumAssetsToPrefetch, NumAssetsLeft));
+			for (PrefetchIndex = FMath::Max(PrefetchIndex, AssetIndex + 1); PrefetchIndex < PrefetchEnd; ++PrefetchIndex)
+			{
+				// don't load assets that will reuse cached validation result
+				if (CanPrefetchAsset(AssetDataList[PrefetchIndex], InSettings) &&
+					!(ResultCache && ResultCache->HasResult(AssetDataList[PrefetchIndex], GetCacheKey(PrefetchIndex))))
+				{
+					Prefetcher->Prefetch(AssetDataList[PrefetchIndex]);
+				}
+			}
+		}
+		// ASSET VALIDATION END
+
 		if (AssetData.HasAnyPackageFlags(PKG_Cooked))
 		{
+			ReleasePrefetchedAsset(AssetData);
 			++OutResults.NumSkipped;
 			continue;
 		}
@@ -350,6 +586,7 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 				->AddToken(FAssetDataToken::Create(AssetData))
 				->AddToken(FTextToken::Create(LOCTEXT("ValidatingAsset", "Skipping asset, directory is excluded.")));
 			}
+			ReleasePrefetchedAsset(AssetData);
 			++OutResults.NumSkipped;
 			continue;
 		}
@@ -371,7 +608,9 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 		}
 		
 		UObject* LoadedAsset = AssetData.FastGetAsset(false);
-		const bool bAlreadyLoaded = LoadedAsset != nullptr;
+		// ASSET VALIDATION BEGIN prefetched assets are loaded for validation
+		const bool bAlreadyLoaded = LoadedAsset != nullptr && !(Prefetcher.IsSet() && Prefetcher->IsPrefetched(AssetData.PackageName));
+		// ASSET VALIDATION END
 
 		TConstArrayView<FAssetData> ValidationExternalObjects;
 		if (const TArray<FAssetData>* ValidationExternalObjectsPtr = AssetsToExternalObjects.Find(AssetData))
@@ -379,17 +618,315 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 			ValidationExternalObjects = *ValidationExternalObjectsPtr;
 		}
 
-// ASSET VALIDATION BEGIN fix epic's bug that bWasAssetLoadedForValidation == bAlreadyLoaded. Should be the opposite
-		FDataValidationContext ValidationContext(!bAlreadyLoaded, InSettings.ValidationUsecase, ValidationExternalObjects);
-// ASSET VALIDATION END
+		UE::AssetValidation::FPendingAssetValidation& PendingAsset = PendingAssets.Emplace_GetRef(AssetData, ValidationExternalObjects, bAlreadyLoaded, InSettings.ValidationUsecase);
+		PendingAsset.bValidated = AssetData.IsValid() && !ValidatedAssets.Contains(AssetData);
 
+		// ASSET VALIDATION BEGIN replay cached validation result for unchanged assets, skip loading and validation
+		if (ResultCache && PendingAsset.bValidated)
+		{
+			PendingAsset.CacheKey = GetCacheKey(AssetIndex);
+			if (ResultCache->FindResult(AssetData, PendingAsset.CacheKey, PendingAsset.Result, *PendingAsset.Context))
+			{
+				// skip parallel validators as well
+				PendingAsset.bCachedResult = true;
+				PendingAsset.bValidated = false;
+				
+				++CheckedAssetsCount;
+				MarkAssetDataValidated(AssetData, PendingAsset.Result);
+			}
+		}
+
+		if (!PendingAsset.bValidated)
+		{
+			// asset reused cached result or has been already validated
+			ReleasePrefetchedAsset(AssetData);
+		}
+		// ASSET VALIDATION END
+
+		if (!PendingAsset.bCachedResult)
+		{
 // ASSET VALIDATION BEGIN move asset load functionality to IsAssetValidWithContext
-		EDataValidationResult AssetResult = IsAssetValidWithContext(AssetData, ValidationContext);
+			// asset result is recorded after parallel validators are merged
+			TGuardValue DeferResultGuard{bDeferAssetResult, !ParallelValidators.IsEmpty()};
+			PendingAsset.Result = IsAssetValidWithContext(AssetData, *PendingAsset.Context);
 // ASSET VALIDATION END
+		}
+
+		// ASSET VALIDATION BEGIN finish validation for a batch of assets
+		if (PendingAssets.Num() >= BatchSize)
+		{
+			FinishBatch();
+		}
+		// ASSET VALIDATION END
+	}
+
+	// ASSET VALIDATION BEGIN finish validation for the remaining batch of assets, even if validation was canceled
+	if (Prefetcher.IsSet())
+	{
+		// assets prefetched past the canceled or limited validation won't be validated
+		Prefetcher->ReleaseAll();
+	}
+	FinishBatch();
+	// ASSET VALIDATION END
+
+	if (ResultCache)
+	{
+		ResultCache->SaveCache();
+	}
+	if (UE::AssetValidation::FDataTableRowCache* RowCache = UE::AssetValidation::FDataTableRowCache::Get())
+	{
+		RowCache->SaveCache();
+	}
+
+	// Broadcast now that we're complete so other systems can go back to their previous state.
+	if (FEditorDelegates::OnPostAssetValidation.IsBound())
+	{
+		FEditorDelegates::OnPostAssetValidation.Broadcast();
+	}
+
+	// calculate and return validation result
+	if (OutResults.NumInvalid > PrevNumInvalid)
+	{
+		return EDataValidationResult::Invalid;
+	}
+	if (OutResults.NumChecked > PrevNumChecked)
+	{
+		return EDataValidationResult::Valid;
+	}
+
+	return EDataValidationResult::NotValidated;
+}
+
+bool UAssetValidationSubsystem::ShouldRunParallelValidation(const FValidateAssetsSettings& InSettings) const
+{
+	// save validation is usually done for a single asset, it is not worth to spin up worker threads
+	return UAssetValidationSettings::Get()->bEnableParallelValidation && InSettings.ValidationUsecase != EDataValidationUsecase::Save
+		&& FApp::ShouldUseThreadingForPerformance();
+}
+
+void UAssetValidationSubsystem::GatherParallelValidators(EDataValidationUsecase Usecase, TArray<UAssetValidator*>& OutValidators) const
+{
+	ForEachEnabledValidator([Usecase, &OutValidators](UEditorValidatorBase* Validator)
+	{
+		if (UAssetValidator* AssetValidator = Cast<UAssetValidator>(Validator))
+		{
+			// K2_CanValidate is a blueprint event, check it on the game thread
+			if (AssetValidator->CanRunParallelMode() && AssetValidator->K2_CanValidate(Usecase))
+			{
+				OutValidators.Add(AssetValidator);
+			}
+		}
+		return true;
+	});
+}
+
+void UAssetValidationSubsystem::SetValidatorsDeferred(bool bDeferred) const
+{
+	for (UAssetValidator* Validator: DeferredValidators)
+	{
+		Validator->SetDeferredToParallelPass(bDeferred);
+	}
+}
+
+void UAssetValidationSubsystem::ValidateAssetsParallel(TArrayView<UE::AssetValidation::FPendingAssetValidation> PendingAssets, TConstArrayView<UAssetValidator*> ParallelValidators) const
+{
+	using namespace UE::AssetValidation;
+	if (PendingAssets.IsEmpty() || ParallelValidators.IsEmpty())
+	{
+		return;
+	}
+	
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(AssetValidationSubsystem_ValidateAssetsParallel, AssetValidationChannel);
+
+	const int32 NumAssets = PendingAssets.Num();
+	const int32 NumValidators = ParallelValidators.Num();
+
+	// resolve loaded assets on the game thread
+	TArray<UObject*> Assets;
+	Assets.SetNumZeroed(NumAssets);
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+	{
+		if (PendingAssets[AssetIndex].bValidated)
+		{
+			Assets[AssetIndex] = PendingAssets[AssetIndex].AssetData.FastGetAsset(false);
+		}
+	}
+
+	// each (validator, asset) pair gets its own validation context, so worker threads never share one
+	TArray<TUniquePtr<FDataValidationContext>> Contexts;
+	Contexts.SetNum(NumValidators * NumAssets);
+	TArray<EDataValidationResult> Results;
+	Results.Init(EDataValidationResult::NotValidated, NumValidators * NumAssets);
+	const bool bCaptureLogs = CurrentSettings.IsSet() && CurrentSettings->bCaptureLogsDuringValidation;
+
+	// pairs that may load objects during validation are validated on the game thread after parallel pass
+	TBitArray<> GameThreadPairs{false, NumValidators * NumAssets};
+	for (int32 ValidatorIndex = 0; ValidatorIndex < NumValidators; ++ValidatorIndex)
+	{
+		for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+		{
+			if (PendingAssets[AssetIndex].bValidated && !ParallelValidators[ValidatorIndex]->CanValidateAssetOffGameThread(PendingAssets[AssetIndex].AssetData, Assets[AssetIndex]))
+			{
+				GameThreadPairs[ValidatorIndex * NumAssets + AssetIndex] = true;
+			}
+		}
+	}
+
+	for (UAssetValidator* Validator: ParallelValidators)
+	{
+		Validator->PrepareParallelValidation();
+	}
+
+	auto ValidatePair = [&](int32 ValidatorIndex, int32 AssetIndex, ELogCaptureScope LogCaptureScope)
+	{
+		const FPendingAssetValidation& PendingAsset = PendingAssets[AssetIndex];
+		const int32 Index = ValidatorIndex * NumAssets + AssetIndex;
+		Contexts[Index] = MakeUnique<FDataValidationContext>(PendingAsset.bWasAssetLoadedForValidation, PendingAsset.Context->GetValidationUsecase(), PendingAsset.ExternalObjects);
+
+		FScopedLogMessageGatherer LogGatherer{bCaptureLogs, LogCaptureScope};
+		Results[Index] = ParallelValidators[ValidatorIndex]->ValidateAssetParallel(PendingAsset.AssetData, Assets[AssetIndex], *Contexts[Index]);
+		AppendMessages(*Contexts[Index], PendingAsset.AssetData, LogGatherer);
+	};
+
+	// validator stores its validation state, so a single validator never runs on more than one worker thread.
+	// Different validators process the same batch concurrently. Game thread is busy with ParallelFor, so loaded assets can't be garbage collected
+	ParallelFor(TEXT("AssetValidation.ParallelValidators"), NumValidators, 1, [&](int32 ValidatorIndex)
+	{
+		for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+		{
+			if (PendingAssets[AssetIndex].bValidated && !GameThreadPairs[ValidatorIndex * NumAssets + AssetIndex])
+			{
+				// capture messages of the current thread only, so each worker gathers messages logged by its own validator
+				ValidatePair(ValidatorIndex, AssetIndex, ELogCaptureScope::Thread);
+			}
+		}
+	});
+
+	for (TConstSetBitIterator<> It{GameThreadPairs}; It; ++It)
+	{
+		ValidatePair(It.GetIndex() / NumAssets, It.GetIndex() % NumAssets, ELogCaptureScope::Process);
+	}
+
+	// merge validation results in asset order, then in validator order
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+	{
+		FPendingAssetValidation& PendingAsset = PendingAssets[AssetIndex];
+		if (!PendingAsset.bValidated)
+		{
+			continue;
+		}
+
+		for (int32 ValidatorIndex = 0; ValidatorIndex < NumValidators; ++ValidatorIndex)
+		{
+			const int32 Index = ValidatorIndex * NumAssets + AssetIndex;
+			AppendMessages(*PendingAsset.Context, *Contexts[Index]);
+			PendingAsset.Result &= Results[Index];
+		}
+
+		// serial validation deferred asset result to parallel validation pass, record it once
+		ValidationResults[static_cast<uint8>(PendingAsset.Result)] += 1;
+	}
+}
+
+bool UAssetValidationSubsystem::ShouldUseValidationCache(const FValidateAssetsSettings& InSettings) const
+{
+	// saved package is about to change, there's no reason to cache its validation result
+	return UAssetValidationSettings::Get()->bUseValidationCache && InSettings.ValidationUsecase != EDataValidationUsecase::Save;
+}
+
+bool UAssetValidationSubsystem::ShouldPrefetchAssets(const FValidateAssetsSettings& InSettings) const
+{
+	// save validation is usually done for a single asset that is already loaded
+	return InSettings.bLoadAssetsForValidation && InSettings.ValidationUsecase != EDataValidationUsecase::Save
+		&& UAssetValidationSettings::Get()->NumAssetsToPrefetch > 0;
+}
+
+bool UAssetValidationSubsystem::CanPrefetchAsset(const FAssetData& AssetData, const FValidateAssetsSettings& InSettings) const
+{
+	// mirror asset filtering done by ValidateAssetsInternal and IsAssetValidWithContext
+	if (!AssetData.IsValid() || !ShouldLoadAsset(AssetData) || ValidatedAssets.Contains(AssetData))
+	{
+		return false;
+	}
+
+	return !InSettings.bSkipExcludedDirectories || !IsPathExcludedFromValidation(AssetData.PackageName.ToString());
+}
+
+bool UAssetValidationSubsystem::ShouldTrimMemory(const FValidateAssetsSettings& InSettings) const
+{
+	// garbage collection is not allowed while package is being saved
+	const int32 HighWaterMarkMB = UAssetValidationSettings::Get()->ValidationMemoryHighWaterMarkMB;
+	if (HighWaterMarkMB <= 0 || InSettings.ValidationUsecase == EDataValidationUsecase::Save)
+	{
+		return false;
+	}
+
+	// validation request nested into asset validation can't trim memory, outer validators may hold pointers to loaded objects
+	if (ValidationDepth > 0)
+	{
+		return false;
+	}
+
+	return FPlatformMemory::GetStats().UsedPhysical >= static_cast<uint64>(HighWaterMarkMB) * 1024 * 1024;
+}
+
+void UAssetValidationSubsystem::TrimMemory(TConstArrayView<TWeakObjectPtr<UPackage>> Packages) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(AssetValidationSubsystem_TrimMemory, AssetValidationChannel);
+	check(IsInGameThread());
+
+	int32 NumPackages = 0;
+	for (const TWeakObjectPtr<UPackage>& WeakPackage: Packages)
+	{
+		UPackage* Package = WeakPackage.Get();
+		// keep packages that were modified while they were loaded, worlds require cleanup before they can be unloaded
+		if (Package == nullptr || Package->IsDirty() || Package->ContainsMap())
+		{
+			continue;
+		}
+
+		// standalone assets survive garbage collection with default keep flags, clear the flag for assets loaded by validation only
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		}, false);
+		++NumPackages;
+	}
+
+	if (NumPackages == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogAssetValidation, Display, TEXT("Memory high water mark %d MB reached (%llu MB used), unloading %d validated packages"),
+		UAssetValidationSettings::Get()->ValidationMemoryHighWaterMarkMB, FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024), NumPackages);
+
+	// assets referenced by editors or user code survive garbage collection, prefetched assets are kept alive by the prefetcher
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void UAssetValidationSubsystem::FinishPendingAssets(
+	FMessageLog& DataValidationLog,
+	TArrayView<UE::AssetValidation::FPendingAssetValidation> PendingAssets,
+	const FValidateAssetsSettings& InSettings,
+	FValidateAssetsResults& OutResults) const
+{
+	for (UE::AssetValidation::FPendingAssetValidation& PendingAsset: PendingAssets)
+	{
+		const FAssetData& AssetData = PendingAsset.AssetData;
+		FDataValidationContext& ValidationContext = *PendingAsset.Context;
+		const EDataValidationResult AssetResult = PendingAsset.Result;
 		
 		// Don't add more messages to ValidationContext after this point because we will no longer add them to the message log
 		UE::AssetValidation::AppendMessages(DataValidationLog, AssetData, ValidationContext);
 
+		// cache key is set only if validation cache is used by this request
+		if (PendingAsset.bValidated && !PendingAsset.CacheKey.IsZero())
+		{
+			ValidationCache->AddResult(AssetData, PendingAsset.CacheKey, AssetResult, ValidationContext);
+		}
+
 		const bool bAnyWarnings = ValidationContext.GetNumWarnings() > 0;
 
 		++OutResults.NumChecked;
@@ -424,6 +961,8 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 				->AddToken(FTextToken::Create(LOCTEXT("NotValidatedDataResult", "has no data validation.")));
 			}
 		}
+
+		OnAssetValidated.Broadcast(AssetData, AssetResult, ValidationContext);
 		
 		if (InSettings.bCollectPerAssetDetails)
 		{
@@ -433,8 +972,8 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 			Details.Result = AssetResult;
 			ValidationContext.SplitIssues(Details.ValidationWarnings, Details.ValidationErrors);
 
-			Details.ExternalObjects.Reserve(ValidationExternalObjects.Num());
-			for (const FAssetData& ExtData : ValidationExternalObjects)
+			Details.ExternalObjects.Reserve(PendingAsset.ExternalObjects.Num());
+			for (const FAssetData& ExtData : PendingAsset.ExternalObjects)
 			{
 				FValidateAssetsExternalObject& ExtDetails = Details.ExternalObjects.Emplace_GetRef();
 				ExtDetails.PackageName = ExtData.PackageName;
@@ -444,24 +983,6 @@ EDataValidationResult UAssetValidationSubsystem::ValidateAssetsInternal(
 		
 		DataValidationLog.Flush();
 	}
-
-	// Broadcast now that we're complete so other systems can go back to their previous state.
-	if (FEditorDelegates::OnPostAssetValidation.IsBound())
-	{
-		FEditorDelegates::OnPostAssetValidation.Broadcast();
-	}
-
-	// calculate and return validation result
-	if (OutResults.NumInvalid > PrevNumInvalid)
-	{
-		return EDataValidationResult::Invalid;
-	}
-	if (OutResults.NumChecked > PrevNumChecked)
-	{
-		return EDataValidationResult::Valid;
-	}
-
-	return EDataValidationResult::NotValidated;
 }
 
 EDataValidationResult UAssetValidationSubsystem::ValidateChangelistsInternal(
@@ -574,12 +1095,34 @@ EDataValidationResult UAssetValidationSubsystem::IsAssetValidWithContext(const F
 	{
 		CurrentSettings = UAssetValidationSettings::Get()->DefaultSettings;
 	}
+
+	// result of an asset from parallel validation batch is recorded by the batch, nested validation requests record their own results
+	const bool bRecordResult = !bDeferAssetResult;
+	TGuardValue DeferResultGuard{bDeferAssetResult, false};
+
+	// nested validation requests (e.g. external objects validated by the world validator) are not a part of parallel validation pass,
+	// so they should run deferred validators as well
+	TGuardValue DepthGuard{ValidationDepth, ValidationDepth + 1};
+	const bool bFirstNestedCall = ValidationDepth == 2 && !DeferredValidators.IsEmpty();
+	if (bFirstNestedCall)
+	{
+		SetValidatorsDeferred(false);
+	}
+	ON_SCOPE_EXIT
+	{
+		if (bFirstNestedCall)
+		{
+			SetValidatorsDeferred(true);
+		}
+	};
 	
 	// explicitly increase validated assets count
 	++CheckedAssetsCount; 
 	
 	const UObject* Asset = AssetData.FastGetAsset(false);
-	if (Asset == nullptr && ShouldLoadAsset(AssetData))
+	// prefetched asset may still be loading, finish loading it here to associate load errors with the asset
+	const bool bPrefetched = AssetPrefetcher != nullptr && AssetPrefetcher->Release(AssetData.PackageName);
+	if ((Asset == nullptr || bPrefetched) && ShouldLoadAsset(AssetData))
 	{
 		UE_LOG(LogAssetValidation, Verbose, TEXT("Loading asset %s for validation"), *AssetData.ToSoftObjectPath().ToString());
 		UE::AssetValidation::FScopedLogMessageGatherer LogGatherer{CurrentSettings->bCaptureAssetLoadLogs};
@@ -621,7 +1164,7 @@ EDataValidationResult UAssetValidationSubsystem::IsAssetValidWithContext(const F
 		});
 	}
 
-	MarkAssetDataValidated(AssetData, Result);
+	MarkAssetDataValidated(AssetData, Result, bRecordResult);
 	return Result;
 }
 
@@ -699,10 +1242,13 @@ bool UAssetValidationSubsystem::ShouldLoadAsset(const FAssetData& AssetData) con
 	return !AssetData.HasAnyPackageFlags(PKG_ContainsMap | PKG_ContainsMapData | PKG_Cooked);
 }
 
-void UAssetValidationSubsystem::MarkAssetDataValidated(const FAssetData& AssetData, EDataValidationResult Result) const
+void UAssetValidationSubsystem::MarkAssetDataValidated(const FAssetData& AssetData, EDataValidationResult Result, bool bRecordResult) const
 {
 	ValidatedAssets.Add(AssetData);
-	ValidationResults[static_cast<uint8>(Result)] += 1;
+	if (bRecordResult)
+	{
+		ValidationResults[static_cast<uint8>(Result)] += 1;
+	}
 }
 
 void UAssetValidationSubsystem::ResetValidationState() const
@@ -46,6 +46,12 @@ void UAssetValidator::PostEditChangeProperty(FPropertyChangedEvent& PropertyChan
 	}
 }
 
+bool UAssetValidator::IsEnabled() const
+{
+	// validator is executed separately as a part of parallel validation pass
+	return !bDeferredToParallelPass && Super::IsEnabled();
+}
+
 bool UAssetValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
 {
 	if (bRequiresLoadedAsset && InObject == nullptr)
@@ -75,6 +81,25 @@ EDataValidationResult UAssetValidator::ValidateAsset(const FAssetData& InAssetDa
 	return Result;
 }
 
+EDataValidationResult UAssetValidator::ValidateAssetParallel(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext)
+{
+	if (InAsset == nullptr)
+	{
+		return ValidateAsset(InAssetData, InContext);
+	}
+	
+	EDataValidationResult Result = EDataValidationResult::NotValidated;
+	
+	ResetValidationState();
+	if (CanValidateAsset_Implementation(InAssetData, InAsset, InContext))
+	{
+		Result &= ValidateLoadedAsset(InAssetData, InAsset, InContext);
+	}
+
+	Result &= ExtractValidationState(InContext);
+	return Result;
+}
+
 void UAssetValidator::LogValidatingAssetMessage(const FAssetData& AssetData, FDataValidationContext& Context)
 {
 	const UAssetValidationSettings& Settings = *UAssetValidationSettings::Get();
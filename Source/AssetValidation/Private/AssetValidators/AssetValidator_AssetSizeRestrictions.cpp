@@ -77,11 +77,8 @@ EDataValidationResult UAssetValidator_AssetSizeRestrictions::ValidateLoadedAsset
 		return Result;
 	}
 	
-	// @todo: reuse dependency tree between calls
-	FAssetDependencyTree AssetTree{};
-
 	FAssetAuditResult AuditResult{InAssetData};
-	if (!AssetTree.AuditAsset(*IAssetRegistry::Get(), InAssetData, AuditResult))
+	if (!FAssetDependencyTree::Get().AuditAsset(*IAssetRegistry::Get(), InAssetData, AuditResult))
 	{
 		UE::AssetValidation::AddTokenMessage(Context, EMessageSeverity::Error, InAssetData, LOCTEXT("AssetSizeRestrictions_AuditFailed", "Failed to audit asset. Unknown error."));
 		return EDataValidationResult::Invalid;
@@ -1,7 +1,10 @@
 ﻿#include "AssetValidators/AssetValidator_DataTable.h"
 
 #include "AssetValidationDefines.h"
+#include "AssetValidationSettings.h"
 #include "PropertyValidatorSubsystem.h"
+#include "ValidationResultCache.h"
+#include "Async/ParallelFor.h"
 
 bool UAssetValidator_DataTable::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
 {
@@ -18,22 +21,97 @@ EDataValidationResult UAssetValidator_DataTable::ValidateLoadedAsset_Implementat
 	UDataTable* DataTable = CastChecked<UDataTable>(InAsset);
 	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
 
-	for (auto& [Name, StructData]: DataTable->GetRowMap())
+	TArray<uint8*> Rows;
+	DataTable->GetRowMap().GenerateValueArray(Rows);
+
+	// rows that haven't changed since last validation replay their cached results
+	UE::AssetValidation::FDataTableRowCache* RowCache = UAssetValidationSettings::Get()->bUseDataTableRowCache ? UE::AssetValidation::FDataTableRowCache::Get() : nullptr;
+	TOptional<UE::AssetValidation::FDataTableRowHasher> RowHasher;
+	const TMap<FIoHash, UE::AssetValidation::FDataTableRowResult>* CachedRows = nullptr;
+	if (RowCache != nullptr && RowStruct != nullptr)
+	{
+		RowHasher.Emplace(DataTable);
+		CachedRows = RowCache->FindRows(DataTable);
+	}
+
+	TArray<FIoHash> RowKeys;
+	RowKeys.SetNum(RowHasher.IsSet() ? Rows.Num() : 0);
+	TArray<const UE::AssetValidation::FDataTableRowResult*> RowResults;
+	RowResults.SetNumZeroed(Rows.Num());
+
+	// rows are independent struct instances, each one is validated with its own validation context.
+	// Calling thread is busy with ParallelFor, so data table can't be modified or garbage collected.
+	// Rows that may load objects during validation are validated on the game thread
+	const EParallelForFlags ParallelForFlags = PropertyValidators->CanValidateStructOffGameThread(RowStruct) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	
+	TArray<FPropertyValidationResult> Results;
+	Results.SetNum(Rows.Num());
+	ParallelFor(TEXT("AssetValidation.DataTableRows"), Rows.Num(), 64, [&](int32 Index)
+	{
+		if (RowHasher.IsSet())
+		{
+			RowKeys[Index] = RowHasher->GetRowKey(Rows[Index]);
+			if (CachedRows != nullptr && !RowKeys[Index].IsZero())
+			{
+				RowResults[Index] = CachedRows->Find(RowKeys[Index]);
+			}
+		}
+
+		if (RowResults[Index] == nullptr)
+		{
+			Results[Index] = PropertyValidators->ValidateStruct(DataTable, RowStruct, Rows[Index]);
+		}
+	}, ParallelForFlags);
+
+	// report issues in row order
+	TMap<FIoHash, UE::AssetValidation::FDataTableRowResult> NewRowResults;
+	NewRowResults.Reserve(RowKeys.Num());
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
 	{
-		FPropertyValidationResult Result = PropertyValidators->ValidateStruct(DataTable, RowStruct, StructData);
-		for (const FText& Text: Result.Warnings)
+		if (const UE::AssetValidation::FDataTableRowResult* CachedResult = RowResults[Index])
+		{
+			for (const FString& Warning: CachedResult->Warnings)
+			{
+				AssetWarning(DataTable, FText::FromString(Warning));
+			}
+			for (const FString& Error: CachedResult->Errors)
+			{
+				AssetFails(DataTable, FText::FromString(Error));
+			}
+
+			NewRowResults.Add(RowKeys[Index], *CachedResult);
+			continue;
+		}
+
+		const FPropertyValidationResult& Result = Results[Index];
+		UE::AssetValidation::FDataTableRowResult RowResult;
+		RowResult.Result = static_cast<uint8>(Result.ValidationResult);
+		
+		for (const FText& Text: Result.GetWarnings())
 		{
 			AssetWarning(DataTable, Text);
+			RowResult.Warnings.Add(Text.ToString());
 		}
 		
 		if (Result.ValidationResult == EDataValidationResult::Invalid)
 		{
-			check(Result.Errors.Num() > 0);
-			for (const FText& Text: Result.Errors)
+			check(Result.NumErrors() > 0);
+			for (const FText& Text: Result.GetErrors())
 			{
 				AssetFails(DataTable, Text);
+				RowResult.Errors.Add(Text.ToString());
 			}
 		}
+
+		if (RowKeys.IsValidIndex(Index) && !RowKeys[Index].IsZero())
+		{
+			NewRowResults.Add(RowKeys[Index], MoveTemp(RowResult));
+		}
+	}
+
+	if (RowHasher.IsSet())
+	{
+		RowCache->SetRows(DataTable, MoveTemp(NewRowResults));
 	}
 
 	if (GetValidationResult() == EDataValidationResult::NotValidated)
@@ -9,7 +9,7 @@ UAssetValidator_ExternalObjects::UAssetValidator_ExternalObjects()
 {
 	bIsConfigDisabled = true; // disabled and hidden, will be removed in future versions
 
-	bCanRunParallelMode = true;
+	bCanRunParallelMode = false; // loads external objects and runs nested validation requests
 	bRequiresLoadedAsset = false;
 	bRequiresTopLevelAsset = false;
 	bCanValidateActors = true;
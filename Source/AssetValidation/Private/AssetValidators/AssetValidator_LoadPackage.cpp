@@ -5,6 +5,63 @@
 #include "AssetValidationStatics.h"
 #include "AssetValidationSubsystem.h"
 #include "DataValidationModule.h"
+#include "PackageLoadJournal.h"
+#include "Algo/Transform.h"
+#include "Misc/DataValidation.h"
+#include "UObject/UObjectHash.h"
+
+namespace UE::AssetValidation
+{
+	/**
+	 * Collects warnings and errors while multiple packages are loaded asynchronously.
+	 * Messages are logged from async loading thread without request information, so they're attributed to a package
+	 * only if they mention its name. Other messages are reported for the whole batch.
+	 * Should be opened on the game thread, so that messages logged by async loading thread are captured as well
+	 */
+	class FAsyncLoadLogCollector: public FScopedLogCapture
+	{
+	public:
+		FAsyncLoadLogCollector()
+			: FScopedLogCapture(true, ELogCaptureScope::Process)
+		{
+			check(IsProcessWide());
+		}
+
+		/** Stop collecting messages and move them to validation context, attributing each message to the first package it mentions */
+		void AppendMessages(TConstArrayView<FAssetData> Assets, FDataValidationContext& Context)
+		{
+			TArray<FString, TInlineAllocator<32>> PackageNames;
+			Algo::Transform(Assets, PackageNames, [](const FAssetData& AssetData) { return AssetData.PackageName.ToString(); });
+			
+			StopCapture([&Assets, &Context, &PackageNames](FString&& Message, ELogVerbosity::Type Verbosity)
+			{
+				const EMessageSeverity::Type Severity = Verbosity == ELogVerbosity::Warning ? EMessageSeverity::Warning : EMessageSeverity::Error;
+				
+				const int32 AssetIndex = PackageNames.IndexOfByPredicate([&Message](const FString& PackageName)
+				{
+					return MentionsPackage(Message, PackageName);
+				});
+				if (AssetIndex != INDEX_NONE)
+				{
+					Context.AddMessage(Assets[AssetIndex], Severity, FText::FromString(MoveTemp(Message)));
+				}
+				else
+				{
+					Context.AddMessage(Severity, FText::Format(NSLOCTEXT("AssetValidation", "BatchLoadMessage", "Logged while loading referencers: {0}"), FText::FromString(MoveTemp(Message))));
+				}
+			});
+		}
+	};
+
+	/** Batch load state shared with load callbacks, as callback of a request may outlive the batch */
+	struct FBatchLoadState
+	{
+		/** completed packages mapped to whether package was loaded successfully */
+		TMap<FName, bool> CompletedPackages;
+		/** packages loaded by the batch */
+		TArray<TWeakObjectPtr<UPackage>> LoadedPackages;
+	};
+}
 
 bool UAssetValidator_LoadPackage::GetPackageLoadErrors(const FString& PackageName, const FAssetData& AssetData, FDataValidationContext& ValidationContext)
 {
@@ -57,6 +114,16 @@ bool UAssetValidator_LoadPackage::GetPackageLoadErrors(const FString& PackageNam
 		return true;
 	}
 
+	if (!Package->IsDirty())
+	{
+		// package wasn't modified after load, replay messages recorded when editor loaded it, unless package file has changed
+		UE::AssetValidation::FPackageLoadJournal* LoadJournal = UE::AssetValidation::FPackageLoadJournal::Get();
+		if (LoadJournal && LoadJournal->ReplayLoadMessages(Package->GetFName(), SourceFilename, AssetData, ValidationContext))
+		{
+			return true;
+		}
+	}
+
 	static int32 PackageIdentifier = 0;
 	const FString DestPackageName = FString::Printf(TEXT("/Temp/%s_%d"), *FPackageName::GetLongPackageAssetName(PackageName), ++PackageIdentifier);
 	const FString DestFilename = FPackageName::LongPackageNameToFilename(DestPackageName, FPaths::GetExtension(SourceFilename, true));
@@ -199,3 +266,116 @@ EDataValidationResult UAssetValidator_LoadPackage::ValidateLoadedAsset_Implement
 	return  EDataValidationResult::Valid;
 }
 
+EDataValidationResult UAssetValidator_LoadPackage::ValidateAssetsBatched(TConstArrayView<FAssetData> Assets, FDataValidationContext& ValidationContext, int32 MaxConcurrentLoads)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UAssetValidator_LoadPackage::ValidateAssetsBatched, AssetValidationChannel);
+	
+	EDataValidationResult Result = EDataValidationResult::Valid;
+
+	TArray<FAssetData, TInlineAllocator<32>> AssetsToLoad;
+	for (const FAssetData& AssetData: Assets)
+	{
+		if (FindPackage(nullptr, *AssetData.PackageName.ToString()) != nullptr)
+		{
+			// package is already in memory, validate it the usual way
+			Result &= ValidateAsset(AssetData, ValidationContext);
+			continue;
+		}
+
+		if (UAssetValidationSubsystem::IsPackageAlreadyLoaded(AssetData.PackageName) || !CanValidateAsset_Implementation(AssetData, nullptr, ValidationContext))
+		{
+			continue;
+		}
+
+		// script packages and packages that are not saved yet are not loaded by GetPackageLoadErrors either
+		if (FPackageName::DoesPackageExist(AssetData.PackageName.ToString()))
+		{
+			UAssetValidationSubsystem::MarkPackageLoaded(AssetData.PackageName);
+			AssetsToLoad.Add(AssetData);
+		}
+	}
+
+	if (AssetsToLoad.IsEmpty())
+	{
+		return Result;
+	}
+
+	const uint32 NumErrors = ValidationContext.GetNumErrors();
+	
+	UE::AssetValidation::FAsyncLoadLogCollector LogCollector;
+	TSharedRef<UE::AssetValidation::FBatchLoadState> LoadState = MakeShared<UE::AssetValidation::FBatchLoadState>();
+	
+	struct FLoadRequest
+	{
+		FName PackageName;
+		int32 RequestId = INDEX_NONE;
+	};
+	/** requests in flight, in issue order */
+	TArray<FLoadRequest> LoadRequests;
+
+	int32 NextAsset = 0;
+	while (NextAsset < AssetsToLoad.Num() || !LoadRequests.IsEmpty())
+	{
+		// issue load requests up to concurrency cap
+		while (NextAsset < AssetsToLoad.Num() && LoadRequests.Num() < FMath::Max(1, MaxConcurrentLoads))
+		{
+			const FName PackageName = AssetsToLoad[NextAsset++].PackageName;
+			
+			// load callback may be executed after the batch is finished, so it writes to shared state only
+			const int32 RequestId = LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+			[LoadState](const FName& LoadedPackageName, UPackage* Package, EAsyncLoadingResult::Type LoadResult)
+			{
+				const bool bSucceeded = Package != nullptr && LoadResult == EAsyncLoadingResult::Succeeded;
+				LoadState->CompletedPackages.Add(LoadedPackageName, bSucceeded);
+				if (bSucceeded)
+				{
+					LoadState->LoadedPackages.Add(Package);
+				}
+			}));
+			LoadRequests.Add(FLoadRequest{PackageName, RequestId});
+		}
+
+		// wait for the oldest request, other requests keep loading in the meantime
+		const FLoadRequest& OldestRequest = LoadRequests[0];
+		if (OldestRequest.RequestId != INDEX_NONE && !LoadState->CompletedPackages.Contains(OldestRequest.PackageName))
+		{
+			FlushAsyncLoading(OldestRequest.RequestId);
+		}
+
+		// oldest request is finished even if its callback wasn't executed, so that we don't wait for it forever.
+		// Package that didn't report completion is treated as failed to load
+		LoadRequests.RemoveAt(0);
+		LoadRequests.RemoveAll([&LoadState](const FLoadRequest& Request)
+		{
+			return LoadState->CompletedPackages.Contains(Request.PackageName);
+		});
+	}
+
+	// attribute collected messages once all packages are loaded, in asset order
+	LogCollector.AppendMessages(AssetsToLoad, ValidationContext);
+	for (const FAssetData& AssetData: AssetsToLoad)
+	{
+		const bool* bSucceeded = LoadState->CompletedPackages.Find(AssetData.PackageName);
+		if (bSucceeded == nullptr || !*bSucceeded)
+		{
+			ValidationContext.AddMessage(AssetData, EMessageSeverity::Error, NSLOCTEXT("AssetValidation", "FailedToLoadPackage", "Failed to load package."));
+		}
+	}
+
+	// packages were loaded only to be validated, let next garbage collection unload them
+	for (const TWeakObjectPtr<UPackage>& WeakPackage: LoadState->LoadedPackages)
+	{
+		UPackage* Package = WeakPackage.Get();
+		if (Package != nullptr && !Package->IsDirty())
+		{
+			ForEachObjectWithPackage(Package, [](UObject* Object)
+			{
+				Object->ClearFlags(RF_Standalone);
+				return true;
+			}, false);
+		}
+	}
+	LoadState->LoadedPackages.Reset();
+
+	return ValidationContext.GetNumErrors() > NumErrors ? EDataValidationResult::Invalid : Result;
+}
@@ -0,0 +1,99 @@
+#include "AssetValidators/AssetValidator_PackageIntegrity.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetValidationStatics.h"
+#include "PackageIntegrityScanner.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/DataValidation.h"
+#include "UObject/UObjectHash.h"
+
+UAssetValidator_PackageIntegrity::UAssetValidator_PackageIntegrity()
+{
+	bIsConfigDisabled = false; // enabled by default
+
+	bCanRunParallelMode = true;
+	bRequiresLoadedAsset = false;
+	bRequiresTopLevelAsset = true;
+	bCanValidateActors = false;
+}
+
+bool UAssetValidator_PackageIntegrity::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	if (!Super::CanValidateAsset_Implementation(InAssetData, InObject, InContext))
+	{
+		return false;
+	}
+
+	if (InContext.GetValidationUsecase() == EDataValidationUsecase::Save)
+	{
+		// package file is about to be overwritten
+		return false;
+	}
+
+	// package file doesn't reflect unsaved changes
+	return InObject == nullptr || !InObject->GetPackage()->IsDirty();
+}
+
+void UAssetValidator_PackageIntegrity::PrepareParallelValidation()
+{
+	UpdateScanner();
+}
+
+void UAssetValidator_PackageIntegrity::UpdateScanner()
+{
+	check(IsInGameThread());
+	using namespace UE::AssetValidation;
+	
+	if (!Scanner.IsValid() || ScannerClassesVersion != GetRegisteredClassesVersionNumber())
+	{
+		FPackageIntegrityScanOptions Options;
+		Options.bCheckSoftReferences = bCheckSoftReferences;
+
+		ScannerClassesVersion = GetRegisteredClassesVersionNumber();
+		Scanner = MakeShared<FPackageIntegrityScanner>(IAssetRegistry::GetChecked(), Options);
+	}
+}
+
+EDataValidationResult UAssetValidator_PackageIntegrity::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	return ValidateAsset_Implementation(InAssetData, Context);
+}
+
+EDataValidationResult UAssetValidator_PackageIntegrity::ValidateAsset_Implementation(const FAssetData& InAssetData, FDataValidationContext& InContext)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UAssetValidator_PackageIntegrity, AssetValidationChannel);
+	using namespace UE::AssetValidation;
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// imports can't be checked against incomplete asset registry
+		return EDataValidationResult::NotValidated;
+	}
+
+	if (IsInGameThread())
+	{
+		UpdateScanner();
+	}
+	// parallel pass builds scanner in PrepareParallelValidation
+	check(Scanner.IsValid());
+
+	TArray<FPackageIntegrityIssue> Issues;
+	if (!Scanner->ScanPackage(InAssetData.PackageName, Issues))
+	{
+		// script package or package that is not saved yet
+		return EDataValidationResult::NotValidated;
+	}
+
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	for (const FPackageIntegrityIssue& Issue: Issues)
+	{
+		AddTokenMessage(InContext, Issue.Severity, InAssetData, Issue.Message);
+		if (Issue.Severity == EMessageSeverity::Error)
+		{
+			Result = EDataValidationResult::Invalid;
+		}
+	}
+
+	return Result;
+}
@@ -21,6 +21,28 @@ bool UAssetValidator_Properties::CanValidateAsset_Implementation(const FAssetDat
 	return InObject != nullptr && !InObject->IsA<UUserDefinedStruct>() && !InObject->IsA<UUserDefinedEnum>();
 }
 
+bool UAssetValidator_Properties::CanValidateAssetOffGameThread(const FAssetData& InAssetData, UObject* InAsset) const
+{
+	if (InAsset == nullptr)
+	{
+		return true;
+	}
+	
+	// objects validated recursively may load soft referenced packages, which is allowed only on the game thread
+	const UPropertyValidatorSubsystem* ValidatorSubsystem = GEditor->GetEditorSubsystem<UPropertyValidatorSubsystem>();
+	check(ValidatorSubsystem);
+
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		if (Blueprint->GeneratedClass && !ValidatorSubsystem->CanValidateStructOffGameThread(Blueprint->GeneratedClass))
+		{
+			return false;
+		}
+	}
+
+	return ValidatorSubsystem->CanValidateStructOffGameThread(InAsset->GetClass());
+}
+
 EDataValidationResult UAssetValidator_Properties::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UAssetValidator_Properties, AssetValidationChannel);
@@ -38,8 +60,8 @@ EDataValidationResult UAssetValidator_Properties::ValidateLoadedAsset_Implementa
 		FPropertyValidationResult OutResult = ValidatorSubsystem->ValidateObject(Blueprint);
 		Result &= OutResult.ValidationResult;
 
-		UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, OutResult.Errors);
-		UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, OutResult.Warnings);
+		UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, OutResult.GetErrors());
+		UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, OutResult.GetWarnings());
 
 		Class = Blueprint->GeneratedClass;
         Object = Class->GetDefaultObject();
@@ -51,8 +73,8 @@ EDataValidationResult UAssetValidator_Properties::ValidateLoadedAsset_Implementa
 	FPropertyValidationResult OutResult = ValidatorSubsystem->ValidateObject(Object);
 	Result &= OutResult.ValidationResult;
 	
-	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, OutResult.Errors);
-	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, OutResult.Warnings);
+	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, OutResult.GetErrors());
+	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, OutResult.GetWarnings());
 	
 	return Result;
 }
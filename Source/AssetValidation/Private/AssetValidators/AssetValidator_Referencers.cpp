@@ -54,75 +54,83 @@ EDataValidationResult UAssetValidator_Referencers::ValidateLoadedAsset_Implement
 		return EDataValidationResult::Valid;
 	}
 
-	UClass* AssetClass = InAsset->GetClass();
 	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
 
+	// answer class checks from asset registry class hierarchy, so that referencer classes don't have to be loaded
+	// accept referencers with a similar class type as validating dependency
+	// this makes blueprints check other blueprints, material functions check material functions and so on
+	const FTopLevelAssetPath AssetClassPath = InAsset->GetClass()->GetClassPathName();
+	TSet<FTopLevelAssetPath> DerivedClasses{AssetClassPath};
+	AssetRegistry.GetDerivedClassNames({AssetClassPath}, {}, DerivedClasses);
+
 	TMap<FName, FAssetData> AllReferencers;
-	TSet<FName> ProcessedPackages;
+	TSet<FName> ProcessedPackages{InAsset->GetPackage()->GetFName()};
 	TArray<FName, TInlineAllocator<32>> Packages{InAsset->GetPackage()->GetFName()};
+	TArray<FName> Referencers;
 	while (Packages.Num())
 	{
-		TArray<FName, TInlineAllocator<16>> NextPackages;
+		// gather closest referencers for a whole level at once
+		FARFilter Filter;
+		Filter.bIncludeOnlyOnDiskAssets = true;
 		for (const FName& Package: Packages)
 		{
-			if (ProcessedPackages.Contains(Package))
-			{
-				continue;
-			}
-			
-			// find closest referencers
-			FARFilter Filter;
-			Filter.bIncludeOnlyOnDiskAssets = true;
-			AssetRegistry.GetReferencers(Package, Filter.PackageNames, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
-
-			// append processed packages before any filtering so that we don't get stuck in an infinite loop
-			ProcessedPackages.Append(Filter.PackageNames);
-			// filter referencers that we don't want to validate
-			Filter.PackageNames.SetNum(Algo::RemoveIf(Filter.PackageNames, [](FName PackageName) { return !UE::AssetValidation::ShouldValidatePackage(PackageName.ToString()); }));
-			
-			TArray<FAssetData> PackageAssets;
-			AssetRegistry.GetAssets(Filter, PackageAssets);
+			Referencers.Reset();
+			AssetRegistry.GetReferencers(Package, Referencers, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
 
-			// add redirectors as a next bunch to process
-			for (const FAssetData& Asset: PackageAssets)
+			for (const FName& Referencer: Referencers)
 			{
-				if (Asset.PackageFlags & (PKG_ContainsMap | PKG_ContainsMapData))
-				{
-					// ignore map related assets
-					continue;
-				}
-				
-				if (Asset.IsRedirector())
-				{
-					// encountered redirector, search further
-					NextPackages.AddUnique(Asset.PackageName);
-				}
+				// mark processed before any filtering so that we don't get stuck in an infinite loop
+				bool bAlreadyProcessed = false;
+				ProcessedPackages.Add(Referencer, &bAlreadyProcessed);
 				
-				FSoftClassPath ClassPath{Asset.AssetClassPath.ToString()};
-				// class path may be unresolved or ill formed, so we should check whether class can be successfully loaded
-				if (const UClass* Class = ClassPath.TryLoadClass<UObject>(); Class && Class->IsChildOf(AssetClass))
+				// filter referencers that we don't want to validate
+				if (!bAlreadyProcessed && UE::AssetValidation::ShouldValidatePackage(Referencer.ToString()))
 				{
-					// add package to referencers only if it contains asset with a similar class type as validating dependency
-					// this makes blueprints check other blueprints, material functions check material functions and so on
-					AllReferencers.Add(Asset.PackageName, Asset);
+					Filter.PackageNames.Add(Referencer);
 				}
 			}
 		}
+		Packages.Reset();
+
+		if (Filter.PackageNames.IsEmpty())
+		{
+			break;
+		}
+		
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssets(Filter, PackageAssets);
 
-		Packages = MoveTemp(NextPackages);
+		for (const FAssetData& Asset: PackageAssets)
+		{
+			if (Asset.PackageFlags & (PKG_ContainsMap | PKG_ContainsMapData))
+			{
+				// ignore map related assets
+				continue;
+			}
+			
+			if (Asset.IsRedirector())
+			{
+				// encountered redirector, search further
+				Packages.AddUnique(Asset.PackageName);
+			}
+			else if (DerivedClasses.Contains(Asset.AssetClassPath))
+			{
+				AllReferencers.Add(Asset.PackageName, Asset);
+			}
+		}
 	}
 
 	UAssetValidationSubsystem* Subsystem = UAssetValidationSubsystem::Get();
 	check(Subsystem);
 
 	EDataValidationResult Result = EDataValidationResult::Valid;
-	if (UAssetValidator* LoadPackageValidator = Subsystem->GetValidator<UAssetValidator_LoadPackage>())
+	if (UAssetValidator_LoadPackage* LoadPackageValidator = Subsystem->GetValidator<UAssetValidator_LoadPackage>())
 	{
-		for (const auto& [Package, Asset]: AllReferencers)
-		{
-			// invoke load package validation for referencers
-			Result &= LoadPackageValidator->ValidateAsset(Asset, Context);
-		}
+		TArray<FAssetData> ReferencerAssets;
+		AllReferencers.GenerateValueArray(ReferencerAssets);
+
+		// invoke load package validation for all referencers at once, loading them asynchronously
+		Result &= LoadPackageValidator->ValidateAssetsBatched(ReferencerAssets, Context, MaxConcurrentLoads);
 	}
 	
 	return Result;
@@ -21,8 +21,8 @@ EDataValidationResult UAssetValidator_WidgetBlueprint::ValidateLoadedAsset_Imple
 
 	FPropertyValidationResult Result = PropertyValidators->ValidateObject(WidgetBlueprint->WidgetTree);
 	
-	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, Result.Errors);
-	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, Result.Warnings);
+	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Error, Result.GetErrors());
+	UE::AssetValidation::AppendMessages(Context, InAssetData, EMessageSeverity::Warning, Result.GetWarnings());
 
 	return Result.ValidationResult;
 }
@@ -15,6 +15,8 @@
 namespace UE::AssetValidation
 {
 	static const FString DisplaySummary{TEXT("Summary")};
+	/** Parameter, csv or json lines file to write audit results to */
+	static const FString OutFile{TEXT("OutFile")};
 }
 
 constexpr float MB = 1.0 / 1024.0 / 1024.0;
@@ -30,7 +32,10 @@ FAVCommandletAction_AuditAssetResult::FAVCommandletAction_AuditAssetResult(const
 	: Super(InResult.AssetData)
 	, DiskSizeMB(InResult.TotalDiskSizeBytes * MB)
 	, MemorySizeMB(InResult.TotalMemorySizeBytes * MB)
+	, InclusiveDiskSizeMB(InResult.InclusiveDiskSizeBytes * MB)
+	, InclusiveMemorySizeMB(InResult.InclusiveMemorySizeBytes * MB)
 	, DependencyCount(InResult.TotalDependencyCount)
+	, MaxDependencyBreadth(InResult.MaxDependencyBreadth)
 	, DependencyChainDepth(InResult.DependencyDepth)
 {
 
@@ -39,6 +44,10 @@ FAVCommandletAction_AuditAssetResult::FAVCommandletAction_AuditAssetResult(const
 void UAVCommandletAction_AuditAssets::InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params)
 {
 	bDisplaySummary = Switches.Contains(UE::AssetValidation::DisplaySummary);
+	if (const FString* Value = Params.Find(UE::AssetValidation::OutFile))
+	{
+		OutFile.FilePath = *Value;
+	}
 }
 
 bool UAVCommandletAction_AuditAssets::Run(const TArray<FAssetData>& InAssets)
@@ -51,48 +60,87 @@ bool UAVCommandletAction_AuditAssets::Run(const TArray<FAssetData>& InAssets)
  	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
 	const int32 NumAssets = InAssets.Num();
 	
-	TArray<FAVCommandletAction_AuditAssetResult> Results;
-	Results.Reserve(NumAssets);
+	// rows are streamed to the report as batches finish, only numbers needed for the summary are kept in memory
+	struct FSummaryEntry
+	{
+		float DiskSizeMB = 0.f;
+		float MemorySizeMB = 0.f;
+		int32 DependencyCount = 0;
+		int32 DependencyChainDepth = 0;
+	};
+	TArray<FSummaryEntry> Results;
+	if (bDisplaySummary)
+	{
+		Results.Reserve(NumAssets);
+	}
+
+	TUniquePtr<UE::AssetValidation::FReportSink> Report;
+	if (!OutFile.FilePath.IsEmpty())
+	{
+		Report = UE::AssetValidation::FReportSink::Create<FAVCommandletAction_AuditAssetResult>(OutFile.FilePath);
+	}
 
+	// dependency tree is shared between audited assets, so that shared dependencies are resolved only once
+	FAssetDependencyTree& DependencyTree = FAssetDependencyTree::Get();
+	// commandlet doesn't hold loaded assets, so audit can unload assets loaded for size estimation
+	DependencyTree.SetAllowAssetUnloading(true);
+
+	// assets are audited in batches, shared dependencies of a batch are resolved and aggregated once
+	constexpr int32 BatchSize = 256;
+	TArray<FAssetAuditResult> AuditResults;
+	
 	FScopedSlowTask SlowTask(NumAssets, LOCTEXT("UAVCommandletAction_AuditAssetsTask", "Audit Assets..."));
 	SlowTask.MakeDialog(NumAssets > UAssetValidationSettings::Get()->NumAssetsToShowCancelButton);
 	
-	for (TEnumerateRef<const FAssetData> AssetData: EnumerateRange(InAssets))
+	for (int32 BatchStart = 0; BatchStart < NumAssets; BatchStart += BatchSize)
 	{
 		if (SlowTask.ShouldCancel())
 		{
 			break;	
 		}
-		SlowTask.EnterProgressFrame(1.0f);
-		
-		FAssetAuditResult AuditResult{*AssetData};
-		FAssetDependencyTree{}.AuditAsset(AssetRegistry, *AssetData, AuditResult);
 
-		Results.Add(FAVCommandletAction_AuditAssetResult{AuditResult});
+		const int32 NumBatchAssets = FMath::Min(BatchSize, NumAssets - BatchStart);
+		SlowTask.EnterProgressFrame(NumBatchAssets);
+		
+		DependencyTree.AuditAssets(AssetRegistry, MakeArrayView(InAssets).Slice(BatchStart, NumBatchAssets), AuditResults);
+		for (const FAssetAuditResult& AuditResult: AuditResults)
+		{
+			const FAVCommandletAction_AuditAssetResult Result{AuditResult};
+			if (Report.IsValid())
+			{
+				Report->AddRow(Result);
+			}
+			if (bDisplaySummary)
+			{
+				Results.Add(FSummaryEntry{Result.DiskSizeMB, Result.MemorySizeMB, Result.DependencyCount, Result.DependencyChainDepth});
+			}
+		}
 	}
 	
-	const FString ExportText = UE::AssetValidation::CsvExport(Results);
-	FFileHelper::SaveStringToFile(ExportText, *FPaths::ConvertRelativePathToFull(OutFile.FilePath));
+	DependencyTree.SetAllowAssetUnloading(false);
+	DependencyTree.UnloadAssets();
+
+	const bool bReportWritten = !Report.IsValid() || Report->Close();
 	
-	if (bDisplaySummary)
+	if (bDisplaySummary && !Results.IsEmpty())
 	{
-		Algo::Sort(Results, [](const FAVCommandletAction_AuditAssetResult& Lhs, const FAVCommandletAction_AuditAssetResult& Rhs)
+		Algo::Sort(Results, [](const FSummaryEntry& Lhs, const FSummaryEntry& Rhs)
 		{
 			return	Lhs.MemorySizeMB < Rhs.MemorySizeMB
 					|| FMath::IsNearlyEqual(Lhs.MemorySizeMB, Rhs.MemorySizeMB) && Lhs.DiskSizeMB < Rhs.DiskSizeMB
 					|| FMath::IsNearlyEqual(Lhs.MemorySizeMB, Rhs.MemorySizeMB) && FMath::IsNearlyEqual(Lhs.DiskSizeMB, Rhs.DiskSizeMB) && Lhs.DependencyCount < Rhs.DependencyCount;
 		});
 		
-		const int32 GigaMemorySizeNumAssets = Algo::IndexOfByPredicate(Results, [](const FAVCommandletAction_AuditAssetResult& Result)
+		const int32 GigaMemorySizeNumAssets = Algo::IndexOfByPredicate(Results, [](const FSummaryEntry& Result)
 		{
 			return (Result.MemorySizeMB / 1024) > 1.0;
 		});
-		const int32 GigaDiskSizeNumAssets = Algo::IndexOfByPredicate(Results, [](const FAVCommandletAction_AuditAssetResult& Result)
+		const int32 GigaDiskSizeNumAssets = Algo::IndexOfByPredicate(Results, [](const FSummaryEntry& Result)
 		{
 			return (Result.DiskSizeMB / 1024) > 1.0;
 		});
 
-		const FAVCommandletAction_AuditAssetResult& Result = Results[Results.Num() / 2];
+		const FSummaryEntry& Result = Results[Results.Num() / 2];
 
 		UE_LOG(LogAssetValidation, Display, TEXT("AuditAssets - Processed %d assets."), NumAssets);
 		UE_LOG(LogAssetValidation, Display, TEXT("AuditAssets - Median Dependency Count: %d"), Result.DependencyCount);
@@ -103,7 +151,7 @@ bool UAVCommandletAction_AuditAssets::Run(const TArray<FAssetData>& InAssets)
 		UE_LOG(LogAssetValidation, Display, TEXT("AuditAssets - Num assets > 1 GB in disk size: %d"), NumAssets - GigaDiskSizeNumAssets + 1);
 	}
 
-	return true;
+	return bReportWritten;
 }
 
 #undef LOCTEXT_NAMESPACE
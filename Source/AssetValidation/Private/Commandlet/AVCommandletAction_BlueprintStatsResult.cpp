@@ -7,6 +7,12 @@
 
 #define LOCTEXT_NAMESPACE "AssetValidation"
 
+namespace UE::AssetValidation
+{
+	/** Parameter, csv or json lines file to write blueprint stats to */
+	static const FString OutFile{TEXT("OutFile")};
+}
+
 FAVCommandletAction_BlueprintStatsResult::FAVCommandletAction_BlueprintStatsResult(const UBlueprint* Blueprint, const FAssetData& AssetData)
 	: Super(AssetData)
 {
@@ -19,6 +25,14 @@ FAVCommandletAction_BlueprintStatsResult::FAVCommandletAction_BlueprintStatsResu
 	Variables	= Blueprint->NewVariables.Num();
 }
 
+void UAVCommandletAction_BlueprintStats::InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params)
+{
+	if (const FString* Value = Params.Find(UE::AssetValidation::OutFile))
+	{
+		OutFile.FilePath = *Value;
+	}
+}
+
 bool UAVCommandletAction_BlueprintStats::Run(const TArray<FAssetData>& InAssets)
 {
 	if (InAssets.IsEmpty())
@@ -30,8 +44,16 @@ bool UAVCommandletAction_BlueprintStats::Run(const TArray<FAssetData>& InAssets)
 	FScopedSlowTask SlowTask(NumAssets, LOCTEXT("UAVCommandletAction_BlueprintNodeCountTask", "Processing Blueprints..."));
 	SlowTask.MakeDialog(NumAssets > UAssetValidationSettings::Get()->NumAssetsToShowCancelButton);
 
-	TArray<FAVCommandletAction_BlueprintStatsResult> Results;
-	Results.Reserve(NumAssets);
+	// rows are streamed to the report as blueprints are processed
+	TUniquePtr<UE::AssetValidation::FReportSink> Report;
+	if (!OutFile.FilePath.IsEmpty())
+	{
+		Report = UE::AssetValidation::FReportSink::Create<FAVCommandletAction_BlueprintStatsResult>(OutFile.FilePath);
+		if (!Report->IsOpen())
+		{
+			return false;
+		}
+	}
 	
 	for (const FAssetData& Asset: InAssets)
 	{
@@ -47,13 +69,13 @@ bool UAVCommandletAction_BlueprintStats::Run(const TArray<FAssetData>& InAssets)
 			continue;
 		}
 		
-		Results.Add(GetBlueprintStats(Blueprint, Asset));
+		if (Report.IsValid())
+		{
+			Report->AddRow(GetBlueprintStats(Blueprint, Asset));
+		}
 	}
 	
-	const FString ExportText = UE::AssetValidation::CsvExport(Results);
-	const bool bResult = FFileHelper::SaveStringToFile(ExportText, *FPaths::ConvertRelativePathToFull(OutFile.FilePath));
-	
-	return bResult;
+	return !Report.IsValid() || Report->Close();
 }
 
 FAVCommandletAction_BlueprintStatsResult UAVCommandletAction_BlueprintStats::GetBlueprintStats(const UBlueprint* Blueprint, const FAssetData& Asset) const
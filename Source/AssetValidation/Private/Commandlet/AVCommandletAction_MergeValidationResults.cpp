@@ -0,0 +1,96 @@
+﻿#include "Commandlet/AVCommandletAction_MergeValidationResults.h"
+
+#include "AssetValidationDefines.h"
+#include "Commandlet/AVCommandletAction_ValidateAssets.h"
+#include "HAL/FileManager.h"
+
+namespace UE::AssetValidation
+{
+	static const TCHAR* Separator{TEXT(",")};
+	/** Parameter, one or more validation reports to merge */
+	static const FString ResultFiles{TEXT("ResultFiles")};
+	/** Parameter, json file to write merged validation report to */
+	static const FString OutFile{TEXT("OutFile")};
+}
+
+void UAVCommandletAction_MergeValidationResults::InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params)
+{
+	if (const FString* Values = Params.Find(UE::AssetValidation::ResultFiles))
+	{
+		Values->ParseIntoArray(ResultFiles, UE::AssetValidation::Separator);
+	}
+	if (const FString* Value = Params.Find(UE::AssetValidation::OutFile))
+	{
+		OutFile.FilePath = *Value;
+	}
+}
+
+bool UAVCommandletAction_MergeValidationResults::Run(const TArray<FAssetData>& Assets)
+{
+	TArray<FString> Filenames;
+	for (const FString& ResultFile: ResultFiles)
+	{
+		const FString FullPath = FPaths::ConvertRelativePathToFull(ResultFile);
+		if (FullPath.Contains(TEXT("*")) || FullPath.Contains(TEXT("?")))
+		{
+			TArray<FString> FoundFiles;
+			IFileManager::Get().FindFiles(FoundFiles, *FullPath, true, false);
+			
+			const FString Directory = FPaths::GetPath(FullPath);
+			for (const FString& FoundFile: FoundFiles)
+			{
+				Filenames.Add(Directory / FoundFile);
+			}
+		}
+		else
+		{
+			Filenames.Add(FullPath);
+		}
+	}
+
+	if (Filenames.IsEmpty())
+	{
+		UE_LOG(LogAssetValidation, Error, TEXT("UAssetValidationCommandlet: No validation reports to merge. Specify them with -ResultFiles=File1,File2,..."));
+		return false;
+	}
+	
+	// sort file names to produce the same report regardless of file system enumeration order
+	Filenames.Sort();
+
+	bool bSuccess = true;
+	FAVCommandletValidationReport MergedReport;
+	for (const FString& Filename: Filenames)
+	{
+		FAVCommandletValidationReport Report;
+		if (!Report.LoadFromFile(Filename))
+		{
+			UE_LOG(LogAssetValidation, Error, TEXT("UAssetValidationCommandlet: Failed to read validation report %s."), *Filename);
+			bSuccess = false;
+			continue;
+		}
+
+		UE_LOG(LogAssetValidation, Display, TEXT("UAssetValidationCommandlet: %s: %d checked, %d invalid."), *Filename, Report.NumChecked, Report.NumInvalid);
+		MergedReport.Append(Report);
+	}
+
+	UE_LOG(LogAssetValidation, Display, TEXT("UAssetValidationCommandlet: Merged %d validation reports."), Filenames.Num());
+	UE_LOG(LogAssetValidation, Display, TEXT("UAssetValidationCommandlet: Requested: %d, Checked: %d, Valid: %d, Invalid: %d, Skipped: %d, Warnings: %d, Unable To Validate: %d."),
+		MergedReport.NumRequested, MergedReport.NumChecked, MergedReport.NumValid, MergedReport.NumInvalid,
+		MergedReport.NumSkipped, MergedReport.NumWarnings, MergedReport.NumUnableToValidate);
+
+	for (const FAVCommandletAction_ValidateAssetResult& AssetResult: MergedReport.Assets)
+	{
+		for (const FString& Error: AssetResult.Errors)
+		{
+			UE_LOG(LogAssetValidation, Error, TEXT("%s: %s"), *AssetResult.AssetPath, *Error);
+		}
+	}
+
+	if (!OutFile.FilePath.IsEmpty() && !MergedReport.SaveToFile(OutFile.FilePath))
+	{
+		UE_LOG(LogAssetValidation, Error, TEXT("UAssetValidationCommandlet: Failed to write merged validation report to %s."), *OutFile.FilePath);
+		bSuccess = false;
+	}
+
+	return bSuccess && MergedReport.NumInvalid == 0;
+}
@@ -0,0 +1,95 @@
+﻿#include "Commandlet/AVCommandletAction_ScanPackages.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetValidationSettings.h"
+#include "PackageIntegrityScanner.h"
+#include "Algo/Unique.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/ScopedSlowTask.h"
+
+#define LOCTEXT_NAMESPACE "AssetValidation"
+
+namespace UE::AssetValidation
+{
+	/** Switch, don't check soft package references */
+	static const FString NoSoftReferences{TEXT("NoSoftReferences")};
+}
+
+void UAVCommandletAction_ScanPackages::InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params)
+{
+	bCheckSoftReferences = !Switches.Contains(UE::AssetValidation::NoSoftReferences);
+}
+
+bool UAVCommandletAction_ScanPackages::Run(const TArray<FAssetData>& Assets)
+{
+	using namespace UE::AssetValidation;
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UAVCommandletAction_ScanPackages::Run, AssetValidationChannel);
+
+	TArray<FName> PackageNames;
+	PackageNames.Reserve(Assets.Num());
+	for (const FAssetData& AssetData: Assets)
+	{
+		PackageNames.Add(AssetData.PackageName);
+	}
+
+	// multiple assets may share a package, scan each package once
+	PackageNames.Sort(FNameLexicalLess{});
+	PackageNames.SetNum(Algo::Unique(PackageNames));
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.WaitForCompletion();
+
+	FPackageIntegrityScanOptions Options;
+	Options.bCheckSoftReferences = bCheckSoftReferences;
+	const FPackageIntegrityScanner Scanner{AssetRegistry, Options};
+
+	const int32 NumPackages = PackageNames.Num();
+	// packages are scanned in batches to report progress, batch results are discarded after they're logged
+	constexpr int32 BatchSize = 4096;
+
+	FScopedSlowTask SlowTask(NumPackages, LOCTEXT("UAVCommandletAction_ScanPackagesTask", "Scan Packages..."));
+	SlowTask.MakeDialog(NumPackages > UAssetValidationSettings::Get()->NumAssetsToShowCancelButton);
+
+	int32 NumInvalid = 0;
+	int32 NumWarnings = 0;
+	TArray<TArray<FPackageIntegrityIssue>> Issues;
+	
+	for (int32 BatchStart = 0; BatchStart < NumPackages; BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			break;
+		}
+
+		const int32 NumBatchPackages = FMath::Min(BatchSize, NumPackages - BatchStart);
+		SlowTask.EnterProgressFrame(NumBatchPackages);
+
+		const TConstArrayView<FName> BatchPackages = MakeArrayView(PackageNames).Slice(BatchStart, NumBatchPackages);
+		Scanner.ScanPackages(BatchPackages, Issues);
+
+		for (int32 Index = 0; Index < NumBatchPackages; ++Index)
+		{
+			bool bHasErrors = false;
+			for (const FPackageIntegrityIssue& Issue: Issues[Index])
+			{
+				if (Issue.Severity == EMessageSeverity::Error)
+				{
+					UE_LOG(LogAssetValidation, Error, TEXT("%s: %s"), *BatchPackages[Index].ToString(), *Issue.Message.ToString());
+					bHasErrors = true;
+				}
+				else
+				{
+					UE_LOG(LogAssetValidation, Warning, TEXT("%s: %s"), *BatchPackages[Index].ToString(), *Issue.Message.ToString());
+					++NumWarnings;
+				}
+			}
+
+			NumInvalid += bHasErrors;
+		}
+	}
+
+	UE_LOG(LogAssetValidation, Display, TEXT("ScanPackages - Scanned %d packages, %d invalid, %d warnings."), NumPackages, NumInvalid, NumWarnings);
+	return NumInvalid == 0;
+}
+
+#undef LOCTEXT_NAMESPACE
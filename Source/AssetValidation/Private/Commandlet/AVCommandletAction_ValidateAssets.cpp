@@ -1,8 +1,13 @@
 ﻿#include "Commandlet/AVCommandletAction_ValidateAssets.h"
 
+#include "AssetValidationDefines.h"
 #include "AssetValidationSettings.h"
 #include "AssetValidationStatics.h"
 #include "EditorValidatorBase.h"
+#include "Algo/Sort.h"
+#include "Commandlet/AVCommandletReportSink.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
 
 namespace UE::AssetValidation
 {
@@ -11,6 +16,73 @@ namespace UE::AssetValidation
 	static const FString DetailedLog{TEXT("DetailedLog")};
 	/** Parameter, disable one or more editor validators */
 	static const FString DisableValidators{TEXT("DisableValidators")};
+	/** Parameter, json file to write validation report to */
+	static const FString OutFile{TEXT("OutFile")};
+	/** Parameter, csv or json lines file to stream per asset validation results to */
+	static const FString ReportFile{TEXT("ReportFile")};
+}
+
+FAVCommandletValidationReport::FAVCommandletValidationReport(const FValidateAssetsResults& Results)
+	: NumRequested(Results.NumRequested)
+	, NumChecked(Results.NumChecked)
+	, NumValid(Results.NumValid)
+	, NumInvalid(Results.NumInvalid)
+	, NumSkipped(Results.NumSkipped)
+	, NumWarnings(Results.NumWarnings)
+	, NumUnableToValidate(Results.NumUnableToValidate)
+	, bAssetLimitReached(Results.bAssetLimitReached)
+{
+	Assets.Reserve(Results.AssetsDetails.Num());
+	for (const auto& [AssetPath, Details]: Results.AssetsDetails)
+	{
+		FAVCommandletAction_ValidateAssetResult& AssetResult = Assets.AddDefaulted_GetRef();
+		AssetResult.AssetName = Details.AssetName.ToString();
+		AssetResult.AssetPath = AssetPath;
+		AssetResult.PackageName = Details.PackageName.ToString();
+		AssetResult.Result = Details.Result;
+		Algo::Transform(Details.ValidationWarnings, AssetResult.Warnings, [](const FText& Text) { return Text.ToString(); });
+		Algo::Transform(Details.ValidationErrors, AssetResult.Errors, [](const FText& Text) { return Text.ToString(); });
+	}
+
+	// sort assets, so that reports don't depend on validation order
+	Algo::SortBy(Assets, &FAVCommandletAction_ValidateAssetResult::AssetPath);
+}
+
+void FAVCommandletValidationReport::Append(const FAVCommandletValidationReport& Other)
+{
+	NumRequested		+= Other.NumRequested;
+	NumChecked			+= Other.NumChecked;
+	NumValid			+= Other.NumValid;
+	NumInvalid			+= Other.NumInvalid;
+	NumSkipped			+= Other.NumSkipped;
+	NumWarnings			+= Other.NumWarnings;
+	NumUnableToValidate	+= Other.NumUnableToValidate;
+	bAssetLimitReached	|= Other.bAssetLimitReached;
+
+	Assets.Append(Other.Assets);
+	Algo::SortBy(Assets, &FAVCommandletAction_ValidateAssetResult::AssetPath);
+}
+
+bool FAVCommandletValidationReport::SaveToFile(const FString& Filename) const
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, JsonString))
+	{
+		return false;
+	}
+	
+	return FFileHelper::SaveStringToFile(JsonString, *FPaths::ConvertRelativePathToFull(Filename));
+}
+
+bool FAVCommandletValidationReport::LoadFromFile(const FString& Filename)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FPaths::ConvertRelativePathToFull(Filename)))
+	{
+		return false;
+	}
+
+	return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, this);
 }
 
 UAVCommandletAction_ValidateAssets::UAVCommandletAction_ValidateAssets()
@@ -22,6 +94,14 @@ void UAVCommandletAction_ValidateAssets::InitFromCommandlet(const TArray<FString
 {
 	ValidationUsecase = EDataValidationUsecase::Commandlet;
 	bDetailedLog = Switches.Contains(UE::AssetValidation::DetailedLog);
+	if (const FString* Value = Params.Find(UE::AssetValidation::OutFile))
+	{
+		OutFile.FilePath = *Value;
+	}
+	if (const FString* Value = Params.Find(UE::AssetValidation::ReportFile))
+	{
+		ReportFile.FilePath = *Value;
+	}
 
 	CommandletDisabledValidators.Reset();
 	if (const FString* Values = Params.Find(UE::AssetValidation::DisableValidators))
@@ -46,7 +126,8 @@ bool UAVCommandletAction_ValidateAssets::Run(const TArray<FAssetData>& Assets)
 {
 	if (Assets.IsEmpty())
 	{
-		return true;
+		// write empty report, so that it can be merged with reports of other shards
+		return OutFile.FilePath.IsEmpty() || FAVCommandletValidationReport{}.SaveToFile(OutFile.FilePath);
 	}
 	
 	UAssetValidationSettings& ProjectSettings = *UAssetValidationSettings::GetMutable();
@@ -57,18 +138,63 @@ bool UAVCommandletAction_ValidateAssets::Run(const TArray<FAssetData>& Assets)
 	Settings.bSkipExcludedDirectories = bSkipExcludedDirectories;
 	Settings.bShowIfNoFailures = true;
 	Settings.ValidationUsecase = EDataValidationUsecase::Commandlet;
+	// collect warnings and errors for each asset, if they should be written to validation report
+	Settings.bCollectPerAssetDetails = !OutFile.FilePath.IsEmpty();
 
 	TArray<UEditorValidatorBase*> TempDisabledValidators;
 	DisableValidators(TempDisabledValidators);
+	ON_SCOPE_EXIT
+	{
+		EnableValidators(TempDisabledValidators);
+	};
+
+	UAssetValidationSubsystem* Subsystem = GEditor->GetEditorSubsystem<UAssetValidationSubsystem>();
+
+	TUniquePtr<UE::AssetValidation::FReportSink> Report;
+	FDelegateHandle AssetValidatedHandle;
+	if (!ReportFile.FilePath.IsEmpty())
+	{
+		Report = UE::AssetValidation::FReportSink::Create<FAVCommandletAction_ValidateAssetResult>(ReportFile.FilePath);
+		AssetValidatedHandle = Subsystem->OnAssetValidated.AddLambda([&Report](const FAssetData& AssetData, EDataValidationResult Result, const FDataValidationContext& Context)
+		{
+			FAVCommandletAction_ValidateAssetResult AssetResult;
+			AssetResult.AssetName = AssetData.AssetName.ToString();
+			AssetResult.AssetPath = AssetData.GetObjectPathString();
+			AssetResult.PackageName = AssetData.PackageName.ToString();
+			AssetResult.Result = Result;
+
+			TArray<FText> Warnings, Errors;
+			Context.SplitIssues(Warnings, Errors);
+			Algo::Transform(Warnings, AssetResult.Warnings, [](const FText& Text) { return Text.ToString(); });
+			Algo::Transform(Errors, AssetResult.Errors, [](const FText& Text) { return Text.ToString(); });
 
-	const UAssetValidationSubsystem* Subsystem = GEditor->GetEditorSubsystem<UAssetValidationSubsystem>();
+			Report->AddRow(AssetResult);
+		});
+	}
 	
 	FValidateAssetsResults Results;
 	Subsystem->ValidateAssetsWithSettings(Assets, Settings, Results);
 
-	EnableValidators(TempDisabledValidators);
+	if (Report.IsValid())
+	{
+		Subsystem->OnAssetValidated.Remove(AssetValidatedHandle);
+		if (!Report->Close())
+		{
+			return false;
+		}
+	}
+
+	if (!OutFile.FilePath.IsEmpty())
+	{
+		const FAVCommandletValidationReport Report{Results};
+		if (!Report.SaveToFile(OutFile.FilePath))
+		{
+			UE_LOG(LogAssetValidation, Error, TEXT("UAssetValidationCommandlet: Failed to write validation report to %s."), *OutFile.FilePath);
+			return false;
+		}
+	}
 	
-	return Results.NumInvalid > 0;
+	return Results.NumInvalid == 0;
 }
 
 void UAVCommandletAction_ValidateAssets::DisableValidators(TArray<UEditorValidatorBase*>& OutDisabledValidators)
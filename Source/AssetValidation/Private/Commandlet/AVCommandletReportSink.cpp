@@ -0,0 +1,426 @@
+﻿#include "Commandlet/AVCommandletReportSink.h"
+
+#include "AssetValidationDefines.h"
+#include "DataTableUtils.h"
+#include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace UE::AssetValidation
+{
+/** formatted rows are written to disk once they exceed this size */
+static constexpr int32 ReportFlushSize = 64 * 1024;
+/** formatted rows are written to disk at least this often */
+static constexpr double ReportFlushInterval = 1.0;
+
+static void AppendJsonString(FString& Out, FStringView Value)
+{
+	Out += TEXT('"');
+	for (const TCHAR Char: Value)
+	{
+		switch (Char)
+		{
+		case TEXT('"'):		Out += TEXT("\\\"");	break;
+		case TEXT('\\'):	Out += TEXT("\\\\");	break;
+		case TEXT('\n'):	Out += TEXT("\\n");		break;
+		case TEXT('\r'):	Out += TEXT("\\r");		break;
+		case TEXT('\t'):	Out += TEXT("\\t");		break;
+		default:
+			if (Char < 0x20)
+			{
+				Out.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+			}
+			else
+			{
+				Out += Char;
+			}
+		}
+	}
+	Out += TEXT('"');
+}
+
+static void AppendCsvString(FString& Out, FStringView Value)
+{
+	Out += TEXT('"');
+	for (const TCHAR Char: Value)
+	{
+		if (Char == TEXT('"'))
+		{
+			Out += TEXT('"');
+		}
+		Out += Char;
+	}
+	Out += TEXT('"');
+}
+
+static void AppendJsonNumber(FString& Out, double Value)
+{
+	if (FMath::IsFinite(Value))
+	{
+		Out += FString::SanitizeFloat(Value);
+	}
+	else
+	{
+		Out += TEXT("null");
+	}
+}
+
+EReportFormat GetReportFormat(const FString& Filename)
+{
+	const FString Extension = FPaths::GetExtension(Filename);
+	return Extension == TEXT("jsonl") || Extension == TEXT("json") ? EReportFormat::JsonLines : EReportFormat::Csv;
+}
+
+FReportRowLayout::FReportRowLayout(const UScriptStruct* InRowStruct)
+	: RowStruct(InRowStruct)
+{
+	check(RowStruct);
+
+	TArray<const UStruct*, TInlineAllocator<4>> StructArray;
+	for (const UStruct* Struct = RowStruct; Struct; Struct = Struct->GetSuperStruct())
+	{
+		StructArray.Add(Struct);
+	}
+
+	// traverse backwards, from parent to child structs, so that base struct columns go first
+	for (int32 Index = StructArray.Num() - 1; Index >= 0; --Index)
+	{
+		for (TFieldIterator<FProperty> It{StructArray[Index], EFieldIterationFlags::None}; It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			FColumn Column;
+			Column.Property = Property;
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				if (!ArrayProperty->Inner->IsA<FStrProperty>())
+				{
+					continue;
+				}
+				Column.Type = EColumnType::StringArray;
+			}
+			else if (Property->IsA<FMapProperty>() || Property->IsA<FSetProperty>() || Property->ArrayDim > 1)
+			{
+				continue;
+			}
+			else if (Property->IsA<FBoolProperty>())		Column.Type = EColumnType::Bool;
+			else if (Property->IsA<FIntProperty>())		Column.Type = EColumnType::Int32;
+			else if (Property->IsA<FInt64Property>())		Column.Type = EColumnType::Int64;
+			else if (Property->IsA<FFloatProperty>())		Column.Type = EColumnType::Float;
+			else if (Property->IsA<FDoubleProperty>())	Column.Type = EColumnType::Double;
+			else if (Property->IsA<FStrProperty>())		Column.Type = EColumnType::String;
+			else if (Property->IsA<FNameProperty>())		Column.Type = EColumnType::Name;
+			else if (Property->IsA<FTextProperty>())		Column.Type = EColumnType::Text;
+			else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				Column.Type = EColumnType::Enum;
+				Column.Enum = EnumProperty->GetEnum();
+				Column.UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+			}
+			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->Enum)
+			{
+				Column.Type = EColumnType::Enum;
+				Column.Enum = ByteProperty->Enum;
+				Column.UnderlyingProperty = ByteProperty;
+			}
+			else if (Property->IsA<FNumericProperty>())	Column.Type = EColumnType::Numeric;
+			else										Column.Type = EColumnType::Other;
+
+			Column.CsvName = Property->GetAuthoredName();
+			Column.JsonName = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+			Columns.Add(MoveTemp(Column));
+		}
+	}
+}
+
+const FReportRowLayout& FReportRowLayout::Get(const UScriptStruct* RowStruct)
+{
+	static FRWLock Lock;
+	static TMap<const UScriptStruct*, TUniquePtr<FReportRowLayout>> Layouts;
+
+	{
+		FReadScopeLock ReadLock{Lock};
+		if (const TUniquePtr<FReportRowLayout>* Layout = Layouts.Find(RowStruct))
+		{
+			return **Layout;
+		}
+	}
+
+	FWriteScopeLock WriteLock{Lock};
+	TUniquePtr<FReportRowLayout>& Layout = Layouts.FindOrAdd(RowStruct);
+	if (!Layout.IsValid())
+	{
+		Layout = MakeUnique<FReportRowLayout>(RowStruct);
+	}
+	return *Layout;
+}
+
+void FReportRowLayout::AppendCsvHeader(FString& Out) const
+{
+	for (int32 Index = 0; Index < Columns.Num(); ++Index)
+	{
+		Out += Columns[Index].CsvName;
+		Out += Index + 1 < Columns.Num() ? TEXT(',') : TEXT('\n');
+	}
+}
+
+void FReportRowLayout::AppendCsvRow(FString& Out, const void* RowData) const
+{
+	FString Value;
+	for (int32 Index = 0; Index < Columns.Num(); ++Index)
+	{
+		Value.Reset();
+		AppendCsvValue(Value, Columns[Index], RowData);
+		AppendCsvString(Out, Value);
+		Out += Index + 1 < Columns.Num() ? TEXT(',') : TEXT('\n');
+	}
+}
+
+void FReportRowLayout::AppendJsonRow(FString& Out, const void* RowData) const
+{
+	Out += TEXT('{');
+	for (int32 Index = 0; Index < Columns.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Out += TEXT(',');
+		}
+		AppendJsonString(Out, Columns[Index].JsonName);
+		Out += TEXT(':');
+		AppendJsonValue(Out, Columns[Index], RowData);
+	}
+	Out += TEXT("}\n");
+}
+
+void FReportRowLayout::AppendValue(FString& Out, const FColumn& Column, const void* RowData) const
+{
+	const FProperty* Property = Column.Property;
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+
+	switch (Column.Type)
+	{
+	case EColumnType::Bool:
+		Out += CastFieldChecked<FBoolProperty>(Property)->GetPropertyValue(ValuePtr) ? TEXT("True") : TEXT("False");
+		break;
+	case EColumnType::Int32:
+		Out.AppendInt(*static_cast<const int32*>(ValuePtr));
+		break;
+	case EColumnType::Int64:
+		Out += LexToString(*static_cast<const int64*>(ValuePtr));
+		break;
+	case EColumnType::Float:
+		Out += LexToString(*static_cast<const float*>(ValuePtr));
+		break;
+	case EColumnType::Double:
+		Out += LexToString(*static_cast<const double*>(ValuePtr));
+		break;
+	case EColumnType::Numeric:
+		Out += CastFieldChecked<FNumericProperty>(Property)->GetNumericPropertyValueToString(ValuePtr);
+		break;
+	case EColumnType::String:
+		Out += *static_cast<const FString*>(ValuePtr);
+		break;
+	case EColumnType::Name:
+		static_cast<const FName*>(ValuePtr)->AppendString(Out);
+		break;
+	case EColumnType::Text:
+		Out += static_cast<const FText*>(ValuePtr)->ToString();
+		break;
+	case EColumnType::Enum:
+		Out += Column.Enum->GetNameStringByValue(Column.UnderlyingProperty->GetSignedIntPropertyValue(ValuePtr));
+		break;
+	case EColumnType::StringArray:
+		Out += FString::Join(*static_cast<const TArray<FString>*>(ValuePtr), TEXT("\n"));
+		break;
+	case EColumnType::Other:
+		Property->ExportTextItem_Direct(Out, ValuePtr, nullptr, nullptr, PPF_None);
+		break;
+	}
+}
+
+void FReportRowLayout::AppendCsvValue(FString& Out, const FColumn& Column, const void* RowData) const
+{
+	// keep csv values the same as data table export (property text export with PPF_ExternalEditor), the way csv reports were written before
+	const void* ValuePtr = Column.Property->ContainerPtrToValuePtr<void>(RowData);
+
+	switch (Column.Type)
+	{
+	case EColumnType::Float:
+		Out += LexToSanitizedString(*static_cast<const float*>(ValuePtr));
+		break;
+	case EColumnType::Double:
+		Out += LexToSanitizedString(*static_cast<const double*>(ValuePtr));
+		break;
+	case EColumnType::Text:
+		FTextStringHelper::WriteToBuffer(Out, *static_cast<const FText*>(ValuePtr));
+		break;
+	case EColumnType::Enum:
+	{
+		// data table export writes authored enumerator names, and doesn't export invalid values and autogenerated _MAX value
+		const int64 Value = Column.UnderlyingProperty->GetSignedIntPropertyValue(ValuePtr);
+		if (Column.Enum->IsValidEnumValue(Value) && Value != Column.Enum->GetMaxEnumValue())
+		{
+			Out += Column.Enum->GetAuthoredNameStringByValue(Value);
+		}
+		else
+		{
+			Out += TEXT("(INVALID)");
+		}
+		break;
+	}
+	case EColumnType::Other:
+		Out += DataTableUtils::GetPropertyValueAsString(Column.Property, static_cast<const uint8*>(RowData), EDataTableExportFlags::None);
+		break;
+	default:
+		// bool, integer, string and name values are exported the same way as plain strings
+		AppendValue(Out, Column, RowData);
+		break;
+	}
+}
+
+void FReportRowLayout::AppendJsonValue(FString& Out, const FColumn& Column, const void* RowData) const
+{
+	const void* ValuePtr = Column.Property->ContainerPtrToValuePtr<void>(RowData);
+
+	switch (Column.Type)
+	{
+	case EColumnType::Bool:
+		Out += CastFieldChecked<FBoolProperty>(Column.Property)->GetPropertyValue(ValuePtr) ? TEXT("true") : TEXT("false");
+		break;
+	case EColumnType::Int32:
+	case EColumnType::Int64:
+		AppendValue(Out, Column, RowData);
+		break;
+	case EColumnType::Float:
+		AppendJsonNumber(Out, *static_cast<const float*>(ValuePtr));
+		break;
+	case EColumnType::Double:
+		AppendJsonNumber(Out, *static_cast<const double*>(ValuePtr));
+		break;
+	case EColumnType::Numeric:
+		if (const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Column.Property); NumericProperty->IsFloatingPoint())
+		{
+			AppendJsonNumber(Out, NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+		}
+		else
+		{
+			AppendValue(Out, Column, RowData);
+		}
+		break;
+	case EColumnType::StringArray:
+	{
+		Out += TEXT('[');
+		const TArray<FString>& Values = *static_cast<const TArray<FString>*>(ValuePtr);
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Out += TEXT(',');
+			}
+			AppendJsonString(Out, Values[Index]);
+		}
+		Out += TEXT(']');
+		break;
+	}
+	default:
+	{
+		FString Value;
+		AppendValue(Value, Column, RowData);
+		AppendJsonString(Out, Value);
+		break;
+	}
+	}
+}
+
+FReportSink::FReportSink(const FString& InFilename, EReportFormat InFormat, const UScriptStruct* RowStruct)
+	: Filename(FPaths::ConvertRelativePathToFull(InFilename))
+	, Format(InFormat)
+	, Layout(FReportRowLayout::Get(RowStruct))
+{
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogAssetValidation, Error, TEXT("Failed to open report file %s for writing."), *Filename);
+		return;
+	}
+
+	if (Format == EReportFormat::Csv)
+	{
+		Layout.AppendCsvHeader(PendingRows);
+	}
+	LastFlushTime = FPlatformTime::Seconds();
+}
+
+FReportSink::~FReportSink()
+{
+	Close();
+}
+
+void FReportSink::AddRow(const void* RowData)
+{
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	if (Format == EReportFormat::Csv)
+	{
+		Layout.AppendCsvRow(PendingRows, RowData);
+	}
+	else
+	{
+		Layout.AppendJsonRow(PendingRows, RowData);
+	}
+
+	if (PendingRows.Len() >= ReportFlushSize || FPlatformTime::Seconds() - LastFlushTime >= ReportFlushInterval)
+	{
+		FlushRows();
+	}
+}
+
+void FReportSink::FlushRows()
+{
+	LastFlushTime = FPlatformTime::Seconds();
+	if (PendingRows.IsEmpty())
+	{
+		return;
+	}
+
+	FTCHARToUTF8 Converted{*PendingRows, PendingRows.Len()};
+	TArray<uint8> Chunk{reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length()};
+	PendingRows.Reset();
+
+	auto WriteChunk = [Archive = Writer.Get(), Chunk = MoveTemp(Chunk)]() mutable
+	{
+		Archive->Serialize(Chunk.GetData(), Chunk.Num());
+		// make written rows available on disk, in case process doesn't finish
+		Archive->Flush();
+	};
+
+	// chain writes, so that chunks are written in order
+	LastWrite = LastWrite.IsValid()
+		? UE::Tasks::Launch(TEXT("AssetValidation.WriteReport"), MoveTemp(WriteChunk), UE::Tasks::Prerequisites(LastWrite))
+		: UE::Tasks::Launch(TEXT("AssetValidation.WriteReport"), MoveTemp(WriteChunk));
+}
+
+bool FReportSink::Close()
+{
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	FlushRows();
+	if (LastWrite.IsValid())
+	{
+		LastWrite.Wait();
+	}
+
+	const bool bSuccess = Writer->Close() && !Writer->IsError();
+	UE_CLOG(!bSuccess, LogAssetValidation, Error, TEXT("Failed to write report file %s."), *Filename);
+
+	Writer.Reset();
+	return bSuccess;
+}
+
+} // UE::AssetValidation
@@ -22,9 +22,27 @@ namespace UE::AssetValidation
 
 	static const FString CommandletAction{TEXT("Action")};
 	static const FString CommandletFilter{TEXT("Filter")};
+	/** Parameter, run commandlet for a single shard of found assets, e.g. -Shard=3/16. Shard index is zero based */
+	static const FString CommandletShard{TEXT("Shard")};
 	
 	static constexpr int32 RESULT_FAIL = 2;
 	static constexpr int32 RESULT_SUCCESS = 0;
+
+	/**
+	 * @return shard index for an asset. Assets are split by package name hash, which is stable between commandlet runs.
+	 * External objects are assigned to the same shard as their outer package, so that world is validated with its external actors
+	 */
+	static int32 GetAssetShardIndex(const FAssetData& AssetData, int32 NumShards)
+	{
+		FString PackageName = AssetData.PackageName.ToString();
+		if (!AssetData.GetOptionalOuterPathName().IsNone())
+		{
+			PackageName = FSoftObjectPath{AssetData.GetOptionalOuterPathName().ToString()}.GetLongPackageName();
+		}
+
+		// don't use FName hash, it depends on name table of a running process
+		return static_cast<int32>(FCrc::StrCrc32(*PackageName.ToLower()) % static_cast<uint32>(NumShards));
+	}
 }
 
 int32 UAssetValidationCommandlet::Main(const FString& Commandline)
@@ -46,35 +64,55 @@ int32 UAssetValidationCommandlet::Main(const FString& Commandline)
 		return {DefaultValue, FString{}};
 	};
 	
-	const auto& [FilterClass, FoundFilterName] = FindClass(UE::AssetValidation::CommandletFilter, UAssetValidationSettings::Get()->CommandletDefaultFilter);
-	if (FilterClass == nullptr)
-	{
-		UE_LOG(LogAssetValidation, Error, TEXT("Failed to find Commandlet Filter: [%s]. Aborting commandlet..."), *FoundFilterName);
-		return UE::AssetValidation::RESULT_FAIL;
-	}
-
 	const auto& [ActionClass, FoundActionName] = FindClass(UE::AssetValidation::CommandletAction, UAssetValidationSettings::Get()->CommandletDefaultAction);
 	if (ActionClass == nullptr)
 	{
 		UE_LOG(LogAssetValidation, Error, TEXT("Failed to find Commandlet Action: [%s]. Aborting commandlet..."), *FoundActionName);
 		return UE::AssetValidation::RESULT_FAIL;
 	}
-	
-	UAVCommandletSearchFilter* SearchFilter = NewObject<UAVCommandletSearchFilter>(this, FilterClass);
-	check(SearchFilter);
 
-	SearchFilter->InitFromCommandlet(Switches, Params);
+	UAVCommandletAction* Action = NewObject<UAVCommandletAction>(this, ActionClass);
+	check(Action);
+
+	Action->InitFromCommandlet(Switches, Params);
 	
 	TArray<FAssetData> Assets;
-	if (!SearchFilter->GetAssets(Assets) || Assets.IsEmpty())
+	if (Action->RequiresAssets())
 	{
-		return UE::AssetValidation::RESULT_FAIL;
-	}
+		const auto& [FilterClass, FoundFilterName] = FindClass(UE::AssetValidation::CommandletFilter, UAssetValidationSettings::Get()->CommandletDefaultFilter);
+		if (FilterClass == nullptr)
+		{
+			UE_LOG(LogAssetValidation, Error, TEXT("Failed to find Commandlet Filter: [%s]. Aborting commandlet..."), *FoundFilterName);
+			return UE::AssetValidation::RESULT_FAIL;
+		}
+		
+		UAVCommandletSearchFilter* SearchFilter = NewObject<UAVCommandletSearchFilter>(this, FilterClass);
+		check(SearchFilter);
 
-	UAVCommandletAction* Action = NewObject<UAVCommandletAction>(this, ActionClass);
-	check(Action);
+		SearchFilter->InitFromCommandlet(Switches, Params);
+		
+		if (!SearchFilter->GetAssets(Assets) || Assets.IsEmpty())
+		{
+			return UE::AssetValidation::RESULT_FAIL;
+		}
+
+		if (const FString* ShardValue = Params.Find(UE::AssetValidation::CommandletShard))
+		{
+			int32 ShardIndex = INDEX_NONE, NumShards = 0;
+			if (!ParseShard(*ShardValue, ShardIndex, NumShards))
+			{
+				UE_LOG(LogAssetValidation, Error, TEXT("Invalid Commandlet Shard: [%s], expected -Shard=Index/Count. Aborting commandlet..."), **ShardValue);
+				return UE::AssetValidation::RESULT_FAIL;
+			}
+
+			const int32 NumFoundAssets = Assets.Num();
+			FilterShardAssets(Assets, ShardIndex, NumShards);
+			
+			// shard can be empty, action still runs to report empty results
+			UE_LOG(LogAssetValidation, Display, TEXT("Running shard %d/%d with %d out of %d assets"), ShardIndex, NumShards, Assets.Num(), NumFoundAssets);
+		}
+	}
 
-	Action->InitFromCommandlet(Switches, Params);
 	if (!Action->Run(Assets))
 	{
 		return UE::AssetValidation::RESULT_FAIL;
@@ -83,6 +121,47 @@ int32 UAssetValidationCommandlet::Main(const FString& Commandline)
 	return UE::AssetValidation::RESULT_SUCCESS;
 }
 
+bool UAssetValidationCommandlet::ParseShard(const FString& Value, int32& OutShardIndex, int32& OutNumShards)
+{
+	// FString::IsNumeric accepts signs and fractions, shard values should contain digits only
+	auto ParseDigits = [](const FString& String, int32& OutValue)
+	{
+		// limit the number of digits, so that value doesn't overflow
+		if (String.IsEmpty() || String.Len() > 9)
+		{
+			return false;
+		}
+		for (const TCHAR Char: String)
+		{
+			if (!FChar::IsDigit(Char))
+			{
+				return false;
+			}
+		}
+		
+		OutValue = FCString::Atoi(*String);
+		return true;
+	};
+	
+	FString IndexString, CountString;
+	if (!Value.Split(TEXT("/"), &IndexString, &CountString) || !ParseDigits(IndexString, OutShardIndex) || !ParseDigits(CountString, OutNumShards))
+	{
+		return false;
+	}
+
+	return OutShardIndex >= 0 && OutShardIndex < OutNumShards;
+}
+
+void UAssetValidationCommandlet::FilterShardAssets(TArray<FAssetData>& Assets, int32 ShardIndex, int32 NumShards)
+{
+	check(NumShards > 0 && ShardIndex >= 0 && ShardIndex < NumShards);
+	
+	Assets.SetNum(Algo::RemoveIf(Assets, [ShardIndex, NumShards](const FAssetData& AssetData)
+	{
+		return UE::AssetValidation::GetAssetShardIndex(AssetData, NumShards) != ShardIndex;
+	}));
+}
+
 void UAssetValidationCommandlet::ParseCommandlineParams(UObject* Target, const TArray<FString>& Switches, const TMap<FString, FString>& Params)
 {
 	UClass* TargetClass = Target->GetClass();
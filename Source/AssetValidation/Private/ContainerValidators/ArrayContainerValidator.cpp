@@ -44,12 +44,12 @@ void UArrayContainerValidator::ValidateProperty(TNonNullPtr<const uint8> Propert
 	const uint32 Num = Array->Num();
 	const uint32 Stride = ValueProperty->ElementSize;
 
+	const bool bVisibleProperty = UE::AssetValidation::IsBlueprintVisibleProperty(ArrayProperty);
 	const uint8* Data = static_cast<const uint8*>(Array->GetData());
 	for (uint32 Index = 0; Index < Num; ++Index)
 	{
 		// add scoped array property prefix
-		const FString Prefix = UE::AssetValidation::GetPropertyDisplayName(ArrayProperty) + "[" + FString::FromInt(Index) + "]";
-		FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, Prefix, UE::AssetValidation::IsBlueprintVisibleProperty(ArrayProperty)};
+		FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, FPropertyValidationContext::FPathElement{ArrayProperty, static_cast<int32>(Index)}, bVisibleProperty};
 		// validate property value
 		ValidationContext.IsPropertyValueValid(Data, ValueProperty, MetaData);
 
@@ -50,30 +50,19 @@ void UMapContainerValidator::ValidateProperty(TNonNullPtr<const uint8> PropertyM
 
 	// UPropertyValidateBase::CanValidatePropertyValue usually checks for Validate meta on ParentProperty to continue with actual validation
 	// To work with other metas like ValidateKey and ValidateValue (to validate only map key or only map value),
-	// we temporarily add Validate meta specifier, so that checks inside other validators pass
-	if (!bHasValidateMeta)
-	{
-		MetaData.SetMetaData(UE::AssetValidation::Validate, FString{});
-	}
+	// key and value are validated with implied Validate meta specifier. Map property meta data is never modified
+	FMetaDataSource ElementMetaData = bHasValidateMeta ? MetaData : MetaData.WithImpliedMetaData(UE::AssetValidation::Validate);
 	
-	const uint32 Num = Map->GetMaxIndex();
-	for (uint32 Index = 0; Index < Num; ++Index)
+	const bool bVisibleProperty = UE::AssetValidation::IsBlueprintVisibleProperty(MapProperty);
+	UE::AssetValidation::ForEachAllocatedIndex(*Map, [&](int32 Index)
 	{
-		if (!Map->IsValidIndex(Index))
-		{
-			continue;
-		}
-		
 		const uint8* Data = static_cast<const uint8*>(Map->GetData(Index, MapLayout));
 
-		// add scoped map property prefix
-		const FString Prefix = UE::AssetValidation::GetPropertyDisplayName(MapProperty) + "[" + FString::FromInt(Index) + "]";
-		
 		if (bCanValidateKey)
 		{
-			// validate key property value
-			FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, Prefix + TEXT(".Key"), UE::AssetValidation::IsBlueprintVisibleProperty(MapProperty)};
-			ValidationContext.IsPropertyValueValid(Data, KeyProperty, MetaData);
+			// validate key property value with scoped map property prefix
+			FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, FPropertyValidationContext::FPathElement{MapProperty, Index, TEXT(".Key")}, bVisibleProperty};
+			ValidationContext.IsPropertyValueValid(Data, KeyProperty, ElementMetaData);
 		}
 
 		// offset to value property
@@ -81,16 +70,9 @@ void UMapContainerValidator::ValidateProperty(TNonNullPtr<const uint8> PropertyM
 
 		if (bCanValidateValue)
 		{
-			// validate value property value
-			FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, Prefix + TEXT(".Value"), UE::AssetValidation::IsBlueprintVisibleProperty(MapProperty)};
-			ValidationContext.IsPropertyValueValid(Data, ValueProperty, MetaData);
+			// validate value property value with scoped map property prefix
+			FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, FPropertyValidationContext::FPathElement{MapProperty, Index, TEXT(".Value")}, bVisibleProperty};
+			ValidationContext.IsPropertyValueValid(Data, ValueProperty, ElementMetaData);
 		}
-		
-	}
-
-	if (!bHasValidateMeta)
-	{
-		// remove Validate meta if it wasn't on map property in a first place
-		MetaData.RemoveMetaData(UE::AssetValidation::Validate);
-	}
+	});
 }
@@ -22,16 +22,15 @@ void UObjectContainerValidator::ValidateProperty(TNonNullPtr<const uint8> Proper
 		FPropertyValidationContext::FScopedSourceObject ScopedObject{ValidationContext, Object};
 		
 		// push either property prefix or object prefix, depending on whether property is visible
-		const FString ObjectName = UE::AssetValidation::ResolveObjectDisplayName(Object, ValidationContext);
 		if (UE::AssetValidation::IsBlueprintVisibleProperty(ObjectProperty))
 		{
 			// push property prefix
-			ValidationContext.PushPrefix(UE::AssetValidation::GetPropertyDisplayName(ObjectProperty)/* + TEXT(".") + ObjectDisplayName*/);
+			ValidationContext.PushPrefix(FPropertyValidationContext::FPathElement{ObjectProperty});
 		}
 		else
 		{
 			// push object prefix
-			ValidationContext.PushPrefix(ObjectName);
+			ValidationContext.PushPrefix(FPropertyValidationContext::FPathElement::FromObject(Object));
 		}
 		
 		FPropertyValidationContext::FScopedSourceObject ScopedSource{ValidationContext, Object};
@@ -43,20 +43,14 @@ void USetContainerValidator::ValidateProperty(TNonNullPtr<const uint8> PropertyM
 	const FProperty* ValueProperty = SetProperty->ElementProp;
 	const FScriptSetLayout Layout = Set->GetScriptLayout(ValueProperty->GetSize(), ValueProperty->GetMinAlignment());
 	
-	const uint32 Num = Set->GetMaxIndex();
-	for (uint32 Index = 0; Index < Num; ++Index)
+	const bool bVisibleProperty = UE::AssetValidation::IsBlueprintVisibleProperty(SetProperty);
+	UE::AssetValidation::ForEachAllocatedIndex(*Set, [&](int32 Index)
 	{
-		if (!Set->IsValidIndex(Index))
-		{
-			continue;
-		}
-		
 		const uint8* Data = static_cast<const uint8*>(Set->GetData(Index, Layout));
 
 		// add scoped set property prefix
-		const FString Prefix = UE::AssetValidation::GetPropertyDisplayName(SetProperty) + "[" + FString::FromInt(Index) + "]";
-		FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, Prefix, UE::AssetValidation::IsBlueprintVisibleProperty(SetProperty)};
+		FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, FPropertyValidationContext::FPathElement{SetProperty, Index}, bVisibleProperty};
 		// validate property value
 		ValidationContext.IsPropertyValueValid(Data, ValueProperty, MetaData);
-	}
+	});
 }
@@ -29,8 +29,7 @@ void UStructContainerValidator::ValidateProperty(TNonNullPtr<const uint8> Proper
 	
 	// push property prefix only if owner property is not a container property
 	// handles 'struct inside array' type of cases
-	const FString Prefix = UE::AssetValidation::GetPropertyDisplayName(StructProperty);
-	FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, Prefix, !bContainerProperty};
+	FPropertyValidationContext::FConditionalPrefix ScopedPrefix{ValidationContext, FPropertyValidationContext::FPathElement{StructProperty}, !bContainerProperty};
 
 	ValidateStructAsContainer(PropertyMemory, StructProperty, MetaData, ValidationContext);
 }
@@ -0,0 +1,56 @@
+﻿#include "EditConditionCache.h"
+
+#include "AssetValidationDefines.h"
+#include "EditConditionContext.h"
+
+namespace UE::AssetValidation
+{
+
+FEditConditionCache& FEditConditionCache::Get()
+{
+	static FEditConditionCache Cache;
+	return Cache;
+}
+
+TSharedPtr<const FEditConditionExpression> FEditConditionCache::FindOrCompile(const UStruct* Struct, const FProperty* Property)
+{
+	check(Struct && Property);
+	const FCacheKey Key{Struct, Property};
+	{
+		FReadScopeLock ReadLock{Lock};
+		if (const TSharedPtr<const FEditConditionExpression>* Found = Expressions.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FEditConditionCache::Compile, AssetValidationChannel);
+	
+	// parse outside of the lock, worst case the same expression is compiled twice by different threads
+	TSharedPtr<FEditConditionExpression> Expression = Parser.Parse(Property->GetMetaData(TEXT("EditCondition")));
+	if (Expression.IsValid())
+	{
+		FEditConditionParser::ResolveTokens(*Expression, Struct);
+	}
+
+	FWriteScopeLock WriteLock{Lock};
+	if (const TSharedPtr<const FEditConditionExpression>* Found = Expressions.Find(Key))
+	{
+		return *Found;
+	}
+	
+	return Expressions.Add(Key, MoveTemp(Expression));
+}
+
+TValueOrError<bool, FText> FEditConditionCache::Evaluate(const FEditConditionExpression& Expression, const FEditConditionContext& Context) const
+{
+	return Parser.Evaluate(Expression, Context);
+}
+
+void FEditConditionCache::Invalidate()
+{
+	FWriteScopeLock WriteLock{Lock};
+	Expressions.Empty();
+}
+	
+} // UE::AssetValidation
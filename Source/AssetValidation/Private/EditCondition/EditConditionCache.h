@@ -0,0 +1,38 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EditConditionParser.h"
+#include "UObject/ObjectKey.h"
+
+namespace UE::AssetValidation
+{
+
+/**
+ * Thread safe cache of compiled edit condition expressions, keyed by struct and property.
+ * Property and enum tokens of cached expressions are resolved for a struct, so evaluation doesn't look up properties by name.
+ * Cache should be invalidated whenever struct layout or property metadata changes
+ */
+class FEditConditionCache
+{
+public:
+	static FEditConditionCache& Get();
+
+	/** @return compiled edit condition expression for a property, nullptr if property doesn't have a valid edit condition */
+	TSharedPtr<const FEditConditionExpression> FindOrCompile(const UStruct* Struct, const FProperty* Property);
+
+	/** Evaluate compiled expression within the given context */
+	TValueOrError<bool, FText> Evaluate(const FEditConditionExpression& Expression, const FEditConditionContext& Context) const;
+
+	/** Discard all compiled expressions */
+	void Invalidate();
+
+private:
+	using FCacheKey = TPair<TObjectKey<UStruct>, const FProperty*>;
+	
+	FEditConditionParser Parser;
+	/** compiled expressions, invalid expressions are stored as nullptr so that they're not parsed again */
+	TMap<FCacheKey, TSharedPtr<const FEditConditionExpression>> Expressions;
+	FRWLock Lock;
+};
+	
+}
@@ -1,4 +1,5 @@
 ﻿#include "EditConditionContext.h"
+#include "EditConditionParser.h"
 #include "PropertyValidators/PropertyValidation.h"
 
 namespace UE::AssetValidation
@@ -17,14 +18,14 @@ FName FEditConditionContext::GetContextName() const
 	return IsValid() ? SourceStruct->GetFName() : NAME_None;
 }
 	
-TOptional<bool> FEditConditionContext::GetBoolValue(const FString& PropertyName) const
+TOptional<bool> FEditConditionContext::GetBoolValue(const FPropertyToken& PropertyToken) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 	
-	const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName});
+	const FProperty* Property = FindProperty(PropertyToken);
 	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
 	{
 		return BoolProperty->GetPropertyValue(BoolProperty->ContainerPtrToValuePtr<void>(Container));
@@ -32,14 +33,14 @@ TOptional<bool> FEditConditionContext::GetBoolValue(const FString& PropertyName)
 	return {};
 }
 
-TOptional<int64> FEditConditionContext::GetIntegerValue(const FString& PropertyName) const
+TOptional<int64> FEditConditionContext::GetIntegerValue(const FPropertyToken& PropertyToken) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 
-	const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName});
+	const FProperty* Property = FindProperty(PropertyToken);
 	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
 	if (NumericProperty == nullptr)
 	{
@@ -50,17 +51,22 @@ TOptional<int64> FEditConditionContext::GetIntegerValue(const FString& PropertyN
 		}
 	}
 
+	if (NumericProperty == nullptr || !NumericProperty->IsInteger())
+	{
+		return {};
+	}
+
 	return NumericProperty->GetSignedIntPropertyValue(NumericProperty->ContainerPtrToValuePtr<void>(Container));
 }
 
-TOptional<double> FEditConditionContext::GetNumericValue(const FString& PropertyName) const
+TOptional<double> FEditConditionContext::GetNumericValue(const FPropertyToken& PropertyToken) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 
-	const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName});
+	const FProperty* Property = FindProperty(PropertyToken);
 	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
 	if (NumericProperty == nullptr)
 	{
@@ -81,14 +87,14 @@ TOptional<double> FEditConditionContext::GetNumericValue(const FString& Property
 	return Result;
 }
 
-TOptional<FString> FEditConditionContext::GetEnumValue(const FString& PropertyName) const
+TOptional<FString> FEditConditionContext::GetEnumValue(const FPropertyToken& PropertyToken) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 
-	const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName});
+	const FProperty* Property = FindProperty(PropertyToken);
 	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
 	
 	const UEnum* EnumType = nullptr;
@@ -113,14 +119,14 @@ TOptional<FString> FEditConditionContext::GetEnumValue(const FString& PropertyNa
 	return EnumType->GetNameStringByValue(Value);
 }
 
-TOptional<UObject*> FEditConditionContext::GetObjectValue(const FString& PropertyName) const
+TOptional<UObject*> FEditConditionContext::GetObjectValue(const FPropertyToken& PropertyToken) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 
-	const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName});
+	const FProperty* Property = FindProperty(PropertyToken);
 	const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
 	if (ObjectProperty == nullptr)
 	{
@@ -131,11 +137,11 @@ TOptional<UObject*> FEditConditionContext::GetObjectValue(const FString& Propert
 	return ObjectProperty->GetObjectPropertyValue(ValuePtr);
 }
 
-TOptional<FString> FEditConditionContext::GetTypeName(const FString& PropertyName) const
+TOptional<FString> FEditConditionContext::GetTypeName(const FPropertyToken& PropertyToken) const
 {
 	if (IsValid())
 	{
-		if (const FProperty* Property = SourceStruct->FindPropertyByName(FName{PropertyName}))
+		if (const FProperty* Property = FindProperty(PropertyToken))
 		{
 			return UE::AssetValidation::GetPropertyTypeName(Property);
 		}
@@ -144,15 +150,21 @@ TOptional<FString> FEditConditionContext::GetTypeName(const FString& PropertyNam
 	return {};
 }
 
-TOptional<int64> FEditConditionContext::GetIntegerValueOfEnum(const FString& EnumTypeName, const FString& MemberName) const
+TOptional<int64> FEditConditionContext::GetIntegerValueOfEnum(const FEnumToken& EnumToken) const
 {
-	const UEnum* EnumType = UClass::TryFindTypeSlow<UEnum>(EnumTypeName, EFindFirstObjectOptions::ExactClass);
+	if (EnumToken.Enum != nullptr)
+	{
+		// enum value is resolved by compiled expression
+		return EnumToken.EnumValue;
+	}
+	
+	const UEnum* EnumType = UClass::TryFindTypeSlow<UEnum>(EnumToken.Type.ToString(), EFindFirstObjectOptions::ExactClass);
 	if (EnumType == nullptr)
 	{
 		return {};
 	}
 
-	const int64 EnumValue = EnumType->GetValueByName(FName(*MemberName));
+	const int64 EnumValue = EnumType->GetValueByName(EnumToken.Value);
 	if (EnumValue == INDEX_NONE)
 	{
 		return {};
@@ -161,4 +173,45 @@ TOptional<int64> FEditConditionContext::GetIntegerValueOfEnum(const FString& Enu
 	return EnumValue;
 }
 
+TOptional<int64> FEditConditionContext::GetIntegerValueOfEnumProperty(const FPropertyToken& PropertyToken, const UEnum* EnumType) const
+{
+	if (!IsValid())
+	{
+		return {};
+	}
+
+	const FProperty* Property = FindProperty(PropertyToken);
+	const FNumericProperty* NumericProperty = nullptr;
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property); EnumProperty && EnumProperty->GetEnum() == EnumType)
+	{
+		NumericProperty = EnumProperty->GetUnderlyingProperty();
+	}
+	else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property); ByteProperty && ByteProperty->GetIntPropertyEnum() == EnumType)
+	{
+		NumericProperty = ByteProperty;
+	}
+
+	if (NumericProperty == nullptr || !NumericProperty->IsInteger())
+	{
+		return {};
+	}
+
+	return NumericProperty->GetSignedIntPropertyValue(NumericProperty->ContainerPtrToValuePtr<void>(Container));
+}
+
+const FProperty* FEditConditionContext::FindProperty(const FPropertyToken& PropertyToken) const
+{
+	if (PropertyToken.Property != nullptr)
+	{
+		return PropertyToken.Property;
+	}
+
+	if (!SourceStruct.IsValid())
+	{
+		return nullptr;
+	}
+	
+	return SourceStruct->FindPropertyByName(PropertyToken.PropertyName);
+}
+
 } // UE::AssetValidation
\ No newline at end of file
@@ -10,6 +10,8 @@ class FProperty;
 namespace UE::AssetValidation
 {
 class FEditConditionExpression;
+struct FPropertyToken;
+struct FEnumToken;
 	
 /**
  * Context required to evaluate edit condition expression
@@ -22,17 +24,22 @@ public:
 
 	FName GetContextName() const;
 
-	TOptional<bool> GetBoolValue(const FString& PropertyName) const;
-	TOptional<int64> GetIntegerValue(const FString& PropertyName) const;
-	TOptional<double> GetNumericValue(const FString& PropertyName) const;
-	TOptional<FString> GetEnumValue(const FString& PropertyName) const;
-	TOptional<UObject*> GetObjectValue(const FString& PropertyName) const;
-	TOptional<FString> GetTypeName(const FString& PropertyName) const;
-	TOptional<int64> GetIntegerValueOfEnum(const FString& EnumType, const FString& EnumValue) const;
+	TOptional<bool> GetBoolValue(const FPropertyToken& PropertyToken) const;
+	TOptional<int64> GetIntegerValue(const FPropertyToken& PropertyToken) const;
+	TOptional<double> GetNumericValue(const FPropertyToken& PropertyToken) const;
+	TOptional<FString> GetEnumValue(const FPropertyToken& PropertyToken) const;
+	TOptional<UObject*> GetObjectValue(const FPropertyToken& PropertyToken) const;
+	TOptional<FString> GetTypeName(const FPropertyToken& PropertyToken) const;
+	TOptional<int64> GetIntegerValueOfEnum(const FEnumToken& EnumToken) const;
+	/** @return integer value of enum property, if property type matches @EnumType */
+	TOptional<int64> GetIntegerValueOfEnumProperty(const FPropertyToken& PropertyToken, const UEnum* EnumType) const;
 	
 	FORCEINLINE bool IsValid() const { return SourceStruct.IsValid() && SourceProperty.IsValid(); }
 	FORCEINLINE FProperty* GetProperty() const { return SourceProperty.Get(); }
 	FORCEINLINE UStruct* GetClass() const { return SourceStruct.Get(); }
+	
+	/** @return property for a token, either resolved by compiled expression or found by name */
+	const FProperty* FindProperty(const FPropertyToken& PropertyToken) const;
 private:
 	
 	TNonNullPtr<const uint8>	Container;
@@ -11,7 +11,9 @@
 #include "Misc/ExpressionParser.h"
 #include "Misc/Optional.h"
 #include "Trace/Detail/Channel.h"
+#include "UObject/Class.h"
 #include "UObject/NameTypes.h"
+#include "UObject/UnrealType.h"
 #include "EditCondition/EditConditionContext.h"
 
 class UObject;
@@ -193,520 +195,409 @@ static TOptional<FExpressionError> ConsumePropertyName(FExpressionTokenConsumer&
 	return TOptional<FExpressionError>();
 }
 
-template <typename T>
-TOptional<T> GetValueInternal(const UE::AssetValidation::FEditConditionContext& Context, const FString& PropertyName)
+namespace UE::AssetValidation
 {
-	return TOptional<T>();
+	/** Edit condition evaluation stack entry, either a value produced by an operator or a compiled operand token */
+	struct FEditConditionOperand
+	{
+		enum class EType: uint8
+		{
+			Bool,
+			Number,
+			Property,
+			Enum,
+			NullPtr,
+			IndexNone
+		};
+
+		FEditConditionOperand() = default;
+		explicit FEditConditionOperand(bool bInValue)
+			: bValue(bInValue)
+			, Type(EType::Bool)
+		{}
+		explicit FEditConditionOperand(double InNumber)
+			: Number(InNumber)
+			, Type(EType::Number)
+		{}
+
+		double Number = 0.0;
+		const FPropertyToken* Property = nullptr;
+		const FEnumToken* Enum = nullptr;
+		bool bValue = false;
+		EType Type = EType::Bool;
+	};
+
+	using FOperandResult = TValueOrError<FEditConditionOperand, FText>;
 }
 
-template<>
-TOptional<bool> GetValueInternal<bool>(const UE::AssetValidation::FEditConditionContext& Context, const FString& PropertyName)
+using UE::AssetValidation::FEditConditionOperand;
+using UE::AssetValidation::FOperandResult;
+
+static FText MakeInvalidOperandError(const UE::AssetValidation::FPropertyToken& Property)
 {
-	return Context.GetBoolValue(PropertyName);
+	return FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromName(Property.PropertyName));
 }
 
-template<>
-TOptional<double> GetValueInternal<double>(const UE::AssetValidation::FEditConditionContext& Context, const FString& PropertyName)
+static FText MakeInvalidOperatorError(const FCompiledToken& Token)
 {
-	return Context.GetNumericValue(PropertyName);
+	return FText::Format(LOCTEXT("InvalidOperator", "EditCondition operator \"{0}\" can't be applied to its operands."), FText::FromString(Token.Context.GetString()));
 }
 
-template <typename T>
-struct TOperand
+static TOptional<FEditConditionOperand> MakeOperand(const FExpressionNode& Node)
 {
-	TOperand(T InValue) : Value(InValue), Property(nullptr), Context(nullptr) {}
-	TOperand(const UE::AssetValidation::FPropertyToken& InProperty, const UE::AssetValidation::FEditConditionContext& InContext) : 
-		Property(&InProperty), Context(&InContext) {}
+	using namespace UE::AssetValidation;
 
-	bool IsProperty() const { return Property != nullptr; }
-	TOptional<T> GetValue() const
+	FEditConditionOperand Operand;
+	if (const bool* BoolValue = Node.Cast<bool>())
 	{
-		if (IsProperty())
-		{
-			return GetValueInternal<T>(*Context, Property->PropertyName);	
-		}
-		
-		return TOptional<T>(Value);
+		return FEditConditionOperand{*BoolValue};
+	}
+	if (const double* NumberValue = Node.Cast<double>())
+	{
+		return FEditConditionOperand{*NumberValue};
+	}
+	if (const FPropertyToken* PropertyToken = Node.Cast<FPropertyToken>())
+	{
+		Operand.Type = FEditConditionOperand::EType::Property;
+		Operand.Property = PropertyToken;
+		return Operand;
+	}
+	if (const FEnumToken* EnumToken = Node.Cast<FEnumToken>())
+	{
+		Operand.Type = FEditConditionOperand::EType::Enum;
+		Operand.Enum = EnumToken;
+		return Operand;
+	}
+	if (Node.Cast<FNullPtrToken>() != nullptr)
+	{
+		Operand.Type = FEditConditionOperand::EType::NullPtr;
+		return Operand;
+	}
+	if (Node.Cast<FIndexNoneToken>() != nullptr)
+	{
+		Operand.Type = FEditConditionOperand::EType::IndexNone;
+		return Operand;
 	}
 
-	const FString& GetName() const { check(IsProperty()); return Property->PropertyName; }
-
-private:
-	T Value;
-	const UE::AssetValidation::FPropertyToken* Property;
-	const UE::AssetValidation::FEditConditionContext* Context;
-};
+	return {};
+}
 
-static FExpressionResult ApplyNot(TOperand<bool> A)
+/** @return bool value of a bool operand or a bool property */
+static TValueOrError<bool, FText> GetBoolValue(const FCompiledToken& Token, const FEditConditionOperand& Operand, const UE::AssetValidation::FEditConditionContext& Context)
 {
-	TOptional<bool> Value = A.GetValue();
-	if (Value.IsSet())
+	if (Operand.Type == FEditConditionOperand::EType::Bool)
 	{
-		return MakeValue(!Value.GetValue());
+		return MakeValue(Operand.bValue);
 	}
-	return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(A.GetName())));
+	if (Operand.Type == FEditConditionOperand::EType::Property)
+	{
+		if (TOptional<bool> Value = Context.GetBoolValue(*Operand.Property); Value.IsSet())
+		{
+			return MakeValue(Value.GetValue());
+		}
+		return MakeError(MakeInvalidOperandError(*Operand.Property));
+	}
+
+	return MakeError(MakeInvalidOperatorError(Token));
 }
 
-template <typename T, typename Function>
-FExpressionResult ApplyBinary(TOperand<T> A, TOperand<T> B, Function Apply)
+/** @return numeric value of a number operand or a numeric property */
+static TValueOrError<double, FText> GetNumericValue(const FCompiledToken& Token, const FEditConditionOperand& Operand, const UE::AssetValidation::FEditConditionContext& Context)
 {
-	TOptional<T> ValueA = A.GetValue();
-	if (!ValueA.IsSet())
+	if (Operand.Type == FEditConditionOperand::EType::Number)
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(A.GetName())));
+		return MakeValue(Operand.Number);
 	}
-
-	TOptional<T> ValueB = B.GetValue();
-	if (!ValueB.IsSet())
+	if (Operand.Type == FEditConditionOperand::EType::Property)
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(B.GetName())));
+		if (TOptional<double> Value = Context.GetNumericValue(*Operand.Property); Value.IsSet())
+		{
+			return MakeValue(Value.GetValue());
+		}
+		return MakeError(MakeInvalidOperandError(*Operand.Property));
 	}
 
-	return MakeValue(Apply(ValueA.GetValue(), ValueB.GetValue()));
+	return MakeError(MakeInvalidOperatorError(Token));
 }
 
-static FExpressionResult ApplyBitwiseAnd(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEnumToken& Enum, const UE::AssetValidation::FEditConditionContext& Context)
+template <typename ValueType, typename FunctionType>
+FOperandResult ApplyBinary(TValueOrError<ValueType, FText>&& A, TValueOrError<ValueType, FText>&& B, FunctionType&& Apply)
 {
-	TOptional<int64> EnumValue = Context.GetIntegerValueOfEnum(Enum.Type, Enum.Value);
-	if (!EnumValue.IsSet())
+	if (A.HasError())
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidEnumValue", "EditCondition attempted to use an invalid enum value \"{0}::{1}\"."), FText::FromString(Enum.Type), FText::FromString(Enum.Value)));
+		return MakeError(A.StealError());
 	}
-
-	TOptional<int64> PropertyValue = Context.GetIntegerValue(Property.PropertyName);
-	if (!PropertyValue.IsSet())
+	if (B.HasError())
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(Property.PropertyName)));
+		return MakeError(B.StealError());
 	}
 
-	return MakeValue((PropertyValue.Get(0) & EnumValue.Get(0)) != 0);
+	return MakeValue(FEditConditionOperand{Apply(A.GetValue(), B.GetValue())});
 }
 
-static FExpressionResult ApplyPropertyIsNull(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
+template <typename FunctionType>
+FOperandResult ApplyBoolBinary(const FCompiledToken& Token, const FEditConditionOperand& A, const FEditConditionOperand& B, const UE::AssetValidation::FEditConditionContext& Context, FunctionType&& Apply)
 {
-	TOptional<FString> TypeName = Context.GetTypeName(Property.PropertyName);
-	if (!TypeName.IsSet())
-	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(Property.PropertyName)));
-	}
+	return ApplyBinary(GetBoolValue(Token, A, Context), GetBoolValue(Token, B, Context), Forward<FunctionType>(Apply));
+}
 
-	TOptional<UObject*> Ptr = Context.GetObjectValue(Property.PropertyName);
-	if (!Ptr.IsSet())
+template <typename FunctionType>
+FOperandResult ApplyNumericBinary(const FCompiledToken& Token, const FEditConditionOperand& A, const FEditConditionOperand& B, const UE::AssetValidation::FEditConditionContext& Context, FunctionType&& Apply)
+{
+	return ApplyBinary(GetNumericValue(Token, A, Context), GetNumericValue(Token, B, Context), Forward<FunctionType>(Apply));
+}
+
+static FOperandResult ApplyBitwiseAnd(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEnumToken& Enum, const UE::AssetValidation::FEditConditionContext& Context)
+{
+	TOptional<int64> EnumValue = Context.GetIntegerValueOfEnum(Enum);
+	if (!EnumValue.IsSet())
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(Property.PropertyName)));
+		return MakeError(FText::Format(LOCTEXT("InvalidEnumValue", "EditCondition attempted to use an invalid enum value \"{0}::{1}\"."), FText::FromName(Enum.Type), FText::FromName(Enum.Value)));
 	}
 
-	bool bIsNull = Ptr.GetValue() == nullptr;
-	if (bNegate)
+	TOptional<int64> PropertyValue = Context.GetIntegerValue(Property);
+	if (!PropertyValue.IsSet())
 	{
-		bIsNull = !bIsNull;
+		return MakeError(MakeInvalidOperandError(Property));
 	}
 
-	return MakeValue(bIsNull);
+	return MakeValue(FEditConditionOperand{(PropertyValue.Get(0) & EnumValue.Get(0)) != 0});
 }
 
-static FExpressionResult ApplyPropertyIsIndexNone(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
+static FOperandResult ApplyPropertyIsNull(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
 {
-	TOptional<FString> TypeName = Context.GetTypeName(Property.PropertyName);
-	if (!TypeName.IsSet())
+	TOptional<UObject*> Ptr = Context.GetObjectValue(Property);
+	if (!Ptr.IsSet())
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(Property.PropertyName)));
+		return MakeError(MakeInvalidOperandError(Property));
 	}
 
-	TOptional<int64> Value = Context.GetIntegerValue(Property.PropertyName);
-	if (!Value.IsSet())
-	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(Property.PropertyName)));
-	}
+	const bool bIsNull = Ptr.GetValue() == nullptr;
+	return MakeValue(FEditConditionOperand{bNegate ? !bIsNull : bIsNull});
+}
 
-	bool bIsIndexNone = Value.GetValue() == (int64)INDEX_NONE;
-	if (bNegate)
+static FOperandResult ApplyPropertyIsIndexNone(const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
+{
+	TOptional<int64> Value = Context.GetIntegerValue(Property);
+	if (!Value.IsSet())
 	{
-		bIsIndexNone = !bIsIndexNone;
+		return MakeError(MakeInvalidOperandError(Property));
 	}
 
-	return MakeValue(bIsIndexNone);
+	const bool bIsIndexNone = Value.GetValue() == (int64)INDEX_NONE;
+	return MakeValue(FEditConditionOperand{bNegate ? !bIsIndexNone : bIsIndexNone});
 }
 
-static FExpressionResult ApplyPropertiesEqual(const UE::AssetValidation::FPropertyToken& A, const UE::AssetValidation::FPropertyToken& B, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
+static FOperandResult ApplyPropertiesEqual(const UE::AssetValidation::FPropertyToken& A, const UE::AssetValidation::FPropertyToken& B, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
 {
-	TOptional<UObject*> PtrA = Context.GetObjectValue(A.PropertyName);
-	TOptional<UObject*> PtrB = Context.GetObjectValue(B.PropertyName);
+	TOptional<UObject*> PtrA = Context.GetObjectValue(A);
+	TOptional<UObject*> PtrB = Context.GetObjectValue(B);
 	if (PtrA.IsSet() && PtrB.IsSet())
 	{
 		const bool bAreEqual = PtrA.GetValue() == PtrB.GetValue();
-		return MakeValue(bNegate ? !bAreEqual : bAreEqual);
+		return MakeValue(FEditConditionOperand{bNegate ? !bAreEqual : bAreEqual});
 	}
 
-	TOptional<FString> TypeNameA = Context.GetTypeName(A.PropertyName);
-	TOptional<FString> TypeNameB = Context.GetTypeName(B.PropertyName);
-	if (!TypeNameA.IsSet())
+	const FProperty* PropertyA = Context.FindProperty(A);
+	if (PropertyA == nullptr)
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(A.PropertyName)));
+		return MakeError(MakeInvalidOperandError(A));
 	}
 
-	if (!TypeNameB.IsSet())
+	const FProperty* PropertyB = Context.FindProperty(B);
+	if (PropertyB == nullptr)
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand", "EditCondition attempted to use an invalid operand \"{0}\"."), FText::FromString(B.PropertyName)));
+		return MakeError(MakeInvalidOperandError(B));
 	}
 
-	if (TypeNameA.GetValue() != TypeNameB.GetValue())
+	// compare property types directly instead of comparing type names
+	if (!PropertyA->SameType(PropertyB))
 	{
-		return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromString(A.PropertyName), FText::FromString(B.PropertyName)));
+		return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromName(A.PropertyName), FText::FromName(B.PropertyName)));
 	}
 
-	TOptional<bool> BoolA = Context.GetBoolValue(A.PropertyName);
-	TOptional<bool> BoolB = Context.GetBoolValue(B.PropertyName);
+	TOptional<bool> BoolA = Context.GetBoolValue(A);
+	TOptional<bool> BoolB = Context.GetBoolValue(B);
 	if (BoolA.IsSet() && BoolB.IsSet())
 	{
 		const bool bAreEqual = BoolA.GetValue() == BoolB.GetValue();
-		return MakeValue(bNegate ? !bAreEqual : bAreEqual);
+		return MakeValue(FEditConditionOperand{bNegate ? !bAreEqual : bAreEqual});
 	}
 
-	TOptional<double> DoubleA = Context.GetNumericValue(A.PropertyName);
-	TOptional<double> DoubleB = Context.GetNumericValue(B.PropertyName);
+	TOptional<double> DoubleA = Context.GetNumericValue(A);
+	TOptional<double> DoubleB = Context.GetNumericValue(B);
 	if (DoubleA.IsSet() && DoubleB.IsSet())
 	{
 		const bool bAreEqual = DoubleA.GetValue() == DoubleB.GetValue();
-		return MakeValue(bNegate ? !bAreEqual : bAreEqual);
+		return MakeValue(FEditConditionOperand{bNegate ? !bAreEqual : bAreEqual});
 	}
 
-	TOptional<FString> EnumA = Context.GetEnumValue(A.PropertyName);
-	TOptional<FString> EnumB = Context.GetEnumValue(B.PropertyName);
+	// properties have the same enum type, compare underlying values instead of value names
+	TOptional<int64> EnumA = Context.GetIntegerValue(A);
+	TOptional<int64> EnumB = Context.GetIntegerValue(B);
 	if (EnumA.IsSet() && EnumB.IsSet())
 	{
 		const bool bAreEqual = EnumA.GetValue() == EnumB.GetValue();
-		return MakeValue(bNegate ? !bAreEqual : bAreEqual);
+		return MakeValue(FEditConditionOperand{bNegate ? !bAreEqual : bAreEqual});
 	}
 
-	return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromString(A.PropertyName), FText::FromString(B.PropertyName)));
+	return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromName(A.PropertyName), FText::FromName(B.PropertyName)));
 }
 
-static void CreateBooleanOperators(TOperatorJumpTable<UE::AssetValidation::FEditConditionContext>& OperatorJumpTable)
+static FOperandResult EnumPropertyEquals(const UE::AssetValidation::FEnumToken& Enum, const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
 {
-	using namespace UE::AssetValidation;
-
-	OperatorJumpTable.MapPreUnary<FNot>([](bool A) { return !A; });
-	OperatorJumpTable.MapPreUnary<FNot>([](const FPropertyToken& A, const FEditConditionContext* Context)
+	if (Enum.Enum != nullptr)
 	{
-		return ApplyNot(TOperand<bool>(A, *Context));
-	});
+		// compiled expression, compare enum types and values directly without going through strings
+		TOptional<int64> ValueProp = Context.GetIntegerValueOfEnumProperty(Property, Enum.Enum);
+		if (ValueProp.IsSet())
+		{
+			bool bEqual = ValueProp.GetValue() == Enum.EnumValue;
+			return MakeValue(FEditConditionOperand{bNegate ? !bEqual : bEqual});
+		}
+	}
+	
+	TOptional<FString> TypeName = Context.GetTypeName(Property);
+	if (!TypeName.IsSet())
+	{
+		return MakeError(FText::Format(LOCTEXT("InvalidOperand_Type", "EditCondition attempted to use an invalid operand \"{0}\" (type error)."), FText::FromName(Property.PropertyName)));
+	}
 
-	// AND
+	if (TypeName.GetValue() != Enum.Type.ToString())
 	{
-		auto ApplyAnd = [](bool First, bool Second) { return First && Second; };
-	
-		OperatorJumpTable.MapBinary<FAnd>(ApplyAnd);
-		OperatorJumpTable.MapBinary<FAnd>([ApplyAnd](const FPropertyToken& A, bool B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B), ApplyAnd);
-		});
-		OperatorJumpTable.MapBinary<FAnd>([ApplyAnd](bool A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A), TOperand<bool>(B, *Context), ApplyAnd);
-		});
-		OperatorJumpTable.MapBinary<FAnd>([ApplyAnd](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B, *Context), ApplyAnd);
-		});
+		return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromName(Property.PropertyName), FText::FromString(Enum.Type.ToString() + TEXT("::") + Enum.Value.ToString())));
 	}
 
-	// OR
+	TOptional<FString> ValueProp = Context.GetEnumValue(Property);
+	if (!ValueProp.IsSet())
 	{
-		auto ApplyOr = [](bool First, bool Second) { return First || Second; };
+		return MakeError(FText::Format(LOCTEXT("InvalidOperand_Value", "EditCondition attempted to use an invalid operand \"{0}\" (value error)."), FText::FromName(Property.PropertyName)));
+	}
 
-		OperatorJumpTable.MapBinary<FOr>(ApplyOr);
-		OperatorJumpTable.MapBinary<FOr>([ApplyOr](const FPropertyToken& A, bool B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B), ApplyOr);
-		});
-		OperatorJumpTable.MapBinary<FOr>([ApplyOr](bool A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A), TOperand<bool>(B, *Context), ApplyOr);
-		});
-		OperatorJumpTable.MapBinary<FOr>([ApplyOr](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B, *Context), ApplyOr);
-		});
+	bool bEqual = ValueProp.GetValue() == Enum.Value.ToString();
+	return MakeValue(FEditConditionOperand{bNegate ? !bEqual : bEqual});
+}
+
+static FOperandResult ApplyEqual(const FCompiledToken& Token, const FEditConditionOperand& A, const FEditConditionOperand& B, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
+{
+	using EType = FEditConditionOperand::EType;
+
+	if (A.Type == EType::Property)
+	{
+		switch (B.Type)
+		{
+		case EType::Property:
+			return ApplyPropertiesEqual(*A.Property, *B.Property, Context, bNegate);
+		case EType::NullPtr:
+			return ApplyPropertyIsNull(*A.Property, Context, bNegate);
+		case EType::IndexNone:
+			return ApplyPropertyIsIndexNone(*A.Property, Context, bNegate);
+		case EType::Enum:
+			return EnumPropertyEquals(*B.Enum, *A.Property, Context, bNegate);
+		default:
+			break;
+		}
 	}
 
-	// EQUALS
+	if (A.Type == EType::Enum)
 	{
-		auto ApplyEqual = [](bool First, bool Second) { return First == Second; };
-
-		OperatorJumpTable.MapBinary<FEqual>(ApplyEqual);
-		OperatorJumpTable.MapBinary<FEqual>([ApplyEqual](const FPropertyToken& A, bool B, const FEditConditionContext* Context)
+		if (B.Type == EType::Enum)
 		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B), ApplyEqual);
-		});
-		OperatorJumpTable.MapBinary<FEqual>([ApplyEqual](bool A, const FPropertyToken& B, const FEditConditionContext* Context)
+			const bool bEqual = A.Enum->Type == B.Enum->Type && A.Enum->Value == B.Enum->Value;
+			return MakeValue(FEditConditionOperand{bNegate ? !bEqual : bEqual});
+		}
+		if (B.Type == EType::Property)
 		{
-			return ApplyBinary(TOperand<bool>(A), TOperand<bool>(B, *Context), ApplyEqual);
-		});
+			return EnumPropertyEquals(*A.Enum, *B.Property, Context, bNegate);
+		}
 	}
 
-	// NOT-EQUALS
+	if (A.Type == EType::Bool || B.Type == EType::Bool)
 	{
-		auto ApplyNotEqual = [](bool First, bool Second) { return First != Second; };
-
-		OperatorJumpTable.MapBinary<FNotEqual>(ApplyNotEqual);
-		OperatorJumpTable.MapBinary<FNotEqual>([ApplyNotEqual](const FPropertyToken& A, bool B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A, *Context), TOperand<bool>(B), ApplyNotEqual);
-		});
-		OperatorJumpTable.MapBinary<FNotEqual>([ApplyNotEqual](bool A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<bool>(A), TOperand<bool>(B, *Context), ApplyNotEqual);
-		});
+		return ApplyBoolBinary(Token, A, B, Context, [bNegate](bool First, bool Second) { return (First == Second) != bNegate; });
+	}
+	if (A.Type == EType::Number || B.Type == EType::Number)
+	{
+		return ApplyNumericBinary(Token, A, B, Context, [bNegate](double First, double Second) { return (First == Second) != bNegate; });
 	}
+
+	return MakeError(MakeInvalidOperatorError(Token));
 }
 
-template <typename T>
-void CreateNumberOperators(TOperatorJumpTable<UE::AssetValidation::FEditConditionContext>& OperatorJumpTable)
+static FOperandResult ApplyBinaryOperator(const FCompiledToken& Token, const FEditConditionOperand& A, const FEditConditionOperand& B, const UE::AssetValidation::FEditConditionContext& Context)
 {
 	using namespace UE::AssetValidation;
+	const FExpressionNode& Node = Token.Node;
 
-	// EQUAL
+	if (Node.Cast<FEqual>())
 	{
-		auto ApplyEqual = [](T First, T Second) { return First == Second; };
-
-		OperatorJumpTable.MapBinary<FEqual>(ApplyEqual);
-		OperatorJumpTable.MapBinary<FEqual>([ApplyEqual](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyEqual);
-		});
-		OperatorJumpTable.MapBinary<FEqual>([ApplyEqual](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyEqual);
-		});
+		return ApplyEqual(Token, A, B, Context, false);
 	}
-
-	// NOT-EQUAL
+	if (Node.Cast<FNotEqual>())
 	{
-		auto ApplyNotEqual = [](T First, T Second) { return First != Second; };
-
-		OperatorJumpTable.MapBinary<FNotEqual>(ApplyNotEqual);
-		OperatorJumpTable.MapBinary<FNotEqual>([ApplyNotEqual](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyNotEqual);
-		});
-		OperatorJumpTable.MapBinary<FNotEqual>([ApplyNotEqual](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyNotEqual);
-		});
+		return ApplyEqual(Token, A, B, Context, true);
 	}
-
-	// GREATER
+	if (Node.Cast<FAnd>())
 	{
-		auto ApplyGreater = [](T First, T Second) { return First > Second; };
-
-		OperatorJumpTable.MapBinary<FGreater>(ApplyGreater);
-		OperatorJumpTable.MapBinary<FGreater>([ApplyGreater](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyGreater);
-		});
-		OperatorJumpTable.MapBinary<FGreater>([ApplyGreater](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyGreater);
-		});
-		OperatorJumpTable.MapBinary<FGreater>([ApplyGreater](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyGreater);
-		});
+		return ApplyBoolBinary(Token, A, B, Context, [](bool First, bool Second) { return First && Second; });
 	}
-
-	// GREATER-EQUAL
+	if (Node.Cast<FOr>())
 	{
-		auto ApplyGreaterEqual = [](T First, T Second) { return First >= Second; };
-
-		OperatorJumpTable.MapBinary<FGreaterEqual>(ApplyGreaterEqual);
-		OperatorJumpTable.MapBinary<FGreaterEqual>([ApplyGreaterEqual](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyGreaterEqual);
-		});
-		OperatorJumpTable.MapBinary<FGreaterEqual>([ApplyGreaterEqual](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyGreaterEqual);
-		});
-		OperatorJumpTable.MapBinary<FGreaterEqual>([ApplyGreaterEqual](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyGreaterEqual);
-		});
+		return ApplyBoolBinary(Token, A, B, Context, [](bool First, bool Second) { return First || Second; });
 	}
-
-	// LESS
+	if (Node.Cast<FGreater>())
 	{
-		auto ApplyLess = [](T First, T Second) { return First < Second; };
-
-		OperatorJumpTable.MapBinary<FLess>(ApplyLess);
-		OperatorJumpTable.MapBinary<FLess>([ApplyLess](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyLess);
-		});
-		OperatorJumpTable.MapBinary<FLess>([ApplyLess](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyLess);
-		});
-		OperatorJumpTable.MapBinary<FLess>([ApplyLess](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyLess);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First > Second; });
 	}
-
-	// LESS-EQUAL
+	if (Node.Cast<FGreaterEqual>())
 	{
-		auto ApplyLessEqual = [](T First, T Second) { return First <= Second; };
-
-		OperatorJumpTable.MapBinary<FLessEqual>(ApplyLessEqual);
-		OperatorJumpTable.MapBinary<FLessEqual>([ApplyLessEqual](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyLessEqual);
-		});
-		OperatorJumpTable.MapBinary<FLessEqual>([ApplyLessEqual](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyLessEqual);
-		});
-		OperatorJumpTable.MapBinary<FLessEqual>([ApplyLessEqual](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyLessEqual);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First >= Second; });
 	}
-
-	// ADD
+	if (Node.Cast<FLess>())
 	{
-		auto ApplyAdd = [](T First, T Second) { return First + Second; };
-
-		OperatorJumpTable.MapBinary<FAdd>(ApplyAdd);
-		OperatorJumpTable.MapBinary<FAdd>([ApplyAdd](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyAdd);
-		});
-		OperatorJumpTable.MapBinary<FAdd>([ApplyAdd](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyAdd);
-		});
-		OperatorJumpTable.MapBinary<FAdd>([ApplyAdd](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyAdd);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First < Second; });
 	}
-
-	// SUBTRACT
+	if (Node.Cast<FLessEqual>())
 	{
-		auto ApplySubtract = [](T First, T Second) { return First - Second; };
-
-		OperatorJumpTable.MapBinary<FSubtract>(ApplySubtract);
-		OperatorJumpTable.MapBinary<FSubtract>([ApplySubtract](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplySubtract);
-		});
-		OperatorJumpTable.MapBinary<FSubtract>([ApplySubtract](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplySubtract);
-		});
-		OperatorJumpTable.MapBinary<FSubtract>([ApplySubtract](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplySubtract);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First <= Second; });
 	}
-
-	// MULTIPLY
+	if (Node.Cast<FAdd>())
 	{
-		auto ApplyMultiply = [](T First, T Second) { return First * Second; };
-
-		OperatorJumpTable.MapBinary<FMultiply>(ApplyMultiply);
-		OperatorJumpTable.MapBinary<FMultiply>([ApplyMultiply](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyMultiply);
-		});
-		OperatorJumpTable.MapBinary<FMultiply>([ApplyMultiply](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyMultiply);
-		});
-		OperatorJumpTable.MapBinary<FMultiply>([ApplyMultiply](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyMultiply);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First + Second; });
 	}
-
-	// DIVIDE
+	if (Node.Cast<FSubtract>())
 	{
-		auto ApplyDivide = [](T First, T Second) { return First / Second; };
-
-		OperatorJumpTable.MapBinary<FDivide>(ApplyDivide);
-		OperatorJumpTable.MapBinary<FDivide>([ApplyDivide](const FPropertyToken& A, T B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B), ApplyDivide);
-		});
-		OperatorJumpTable.MapBinary<FDivide>([ApplyDivide](T A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A), TOperand<T>(B, *Context), ApplyDivide);
-		});
-		OperatorJumpTable.MapBinary<FDivide>([ApplyDivide](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return ApplyBinary(TOperand<T>(A, *Context), TOperand<T>(B, *Context), ApplyDivide);
-		});
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First - Second; });
 	}
-}
-
-static FExpressionResult EnumPropertyEquals(const UE::AssetValidation::FEnumToken& Enum, const UE::AssetValidation::FPropertyToken& Property, const UE::AssetValidation::FEditConditionContext& Context, bool bNegate)
-{
-	TOptional<FString> TypeName = Context.GetTypeName(Property.PropertyName);
-	if (!TypeName.IsSet())
+	if (Node.Cast<FMultiply>())
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand_Type", "EditCondition attempted to use an invalid operand \"{0}\" (type error)."), FText::FromString(Property.PropertyName)));
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First * Second; });
 	}
-
-	if (TypeName.GetValue() != Enum.Type)
+	if (Node.Cast<FDivide>())
 	{
-		return MakeError(FText::Format(LOCTEXT("OperandTypeMismatch", "EditCondition attempted to compare operands of different types: \"{0}\" and \"{1}\"."), FText::FromString(Property.PropertyName), FText::FromString(Enum.Type + TEXT("::") + Enum.Value)));
+		return ApplyNumericBinary(Token, A, B, Context, [](double First, double Second) { return First / Second; });
 	}
-
-	TOptional<FString> ValueProp = Context.GetEnumValue(Property.PropertyName);
-	if (!ValueProp.IsSet())
+	if (Node.Cast<FBitwiseAnd>() && A.Type == FEditConditionOperand::EType::Property && B.Type == FEditConditionOperand::EType::Enum)
 	{
-		return MakeError(FText::Format(LOCTEXT("InvalidOperand_Value", "EditCondition attempted to use an invalid operand \"{0}\" (value error)."), FText::FromString(Property.PropertyName)));
+		return ApplyBitwiseAnd(*A.Property, *B.Enum, Context);
 	}
 
-	bool bEqual = ValueProp.GetValue() == Enum.Value;
-	return MakeValue(bNegate ? !bEqual : bEqual);
+	return MakeError(MakeInvalidOperatorError(Token));
 }
 
-static void CreateEnumOperators(TOperatorJumpTable<UE::AssetValidation::FEditConditionContext>& OperatorJumpTable)
+static FOperandResult ApplyPreUnaryOperator(const FCompiledToken& Token, const FEditConditionOperand& A, const UE::AssetValidation::FEditConditionContext& Context)
 {
-	using namespace UE::AssetValidation;
-
-	// EQUALS
+	if (Token.Node.Cast<UE::AssetValidation::FNot>())
 	{
-		OperatorJumpTable.MapBinary<FEqual>([](const FEnumToken& A, const FEnumToken& B, const FEditConditionContext* Context)
-		{
-			return A.Type == B.Type && A.Value == B.Value;
-		});
-		OperatorJumpTable.MapBinary<FEqual>([](const FPropertyToken& A, const FEnumToken& B, const FEditConditionContext* Context)
+		TValueOrError<bool, FText> Value = GetBoolValue(Token, A, Context);
+		if (Value.HasError())
 		{
-			return EnumPropertyEquals(B, A, *Context, false);
-		});
-		OperatorJumpTable.MapBinary<FEqual>([](const FEnumToken& A, const FPropertyToken& B, const FEditConditionContext* Context)
-		{
-			return EnumPropertyEquals(A, B, *Context, false);
-		});
+			return MakeError(Value.StealError());
+		}
+		return MakeValue(FEditConditionOperand{!Value.GetValue()});
 	}
 
-	// NOT-EQUALS
-	{
-		OperatorJumpTable.MapBinary<FNotEqual>([](const FEnumToken& A, const FEnumToken& B, const FEditConditionContext* Context)
-		{
-			return A.Type != B.Type || A.Value != B.Value;
-		});
-		OperatorJumpTable.MapBinary<FNotEqual>([](const FPropertyToken& A, const FEnumToken& B, const FEditConditionContext* Context) -> FExpressionResult
-		{
-			return EnumPropertyEquals(B, A, *Context, true);
-		});
-		OperatorJumpTable.MapBinary<FNotEqual>([](const FEnumToken& A, const FPropertyToken& B, const FEditConditionContext* Context) -> FExpressionResult
-		{
-			return EnumPropertyEquals(A, B, *Context, true);
-		});
-	}
+	return MakeError(MakeInvalidOperatorError(Token));
 }
 
 UE::AssetValidation::FEditConditionParser::FEditConditionParser()
@@ -751,77 +642,109 @@ UE::AssetValidation::FEditConditionParser::FEditConditionParser()
 	ExpressionGrammar.DefineBinaryOperator<FDivide>(1);
 	ExpressionGrammar.DefinePreUnaryOperator<FNot>();
 	ExpressionGrammar.DefineGrouping<FSubExpressionStart, FSubExpressionEnd>();
+}
 
-	// POINTER EQUALITY
-	OperatorJumpTable.MapBinary<FEqual>([](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context) -> FExpressionResult
-	{
-		return ApplyPropertiesEqual(A, B, *Context, false);
-	});
-
-	OperatorJumpTable.MapBinary<FNotEqual>([](const FPropertyToken& A, const FPropertyToken& B, const FEditConditionContext* Context) -> FExpressionResult
-	{
-		return ApplyPropertiesEqual(A, B, *Context, true);
-	});
-
-	// POINTER NULL
-	OperatorJumpTable.MapBinary<FEqual>([](const FPropertyToken& A, const FNullPtrToken& B, const FEditConditionContext* Context) -> FExpressionResult
-	{
-		return ApplyPropertyIsNull(A, *Context, false);
-	});
+TValueOrError<bool, FText> UE::AssetValidation::FEditConditionParser::Evaluate(const FEditConditionExpression& Expression, const UE::AssetValidation::FEditConditionContext& Context) const
+{
+	using namespace UE::AssetValidation;
 
-	OperatorJumpTable.MapBinary<FNotEqual>([](const FPropertyToken& A, const FNullPtrToken& B, const FEditConditionContext* Context) -> FExpressionResult
+	// compiled tokens are in reverse polish notation. Operand stack is allocated inline and operands reference compiled tokens,
+	// so evaluation doesn't allocate unless expression fails to evaluate
+	TArray<FEditConditionOperand, TInlineAllocator<16>> Operands;
+	for (const FCompiledToken& Token: Expression.Tokens)
 	{
-		return ApplyPropertyIsNull(A, *Context, true);
-	});
+		switch (Token.Type)
+		{
+		case FCompiledToken::Operand:
+		{
+			TOptional<FEditConditionOperand> Operand = MakeOperand(Token.Node);
+			if (!Operand.IsSet())
+			{
+				return MakeError(FText::Format(LOCTEXT("InvalidToken", "EditCondition contains unknown operand \"{0}\"."), FText::FromString(Token.Context.GetString())));
+			}
+			Operands.Add(Operand.GetValue());
+			break;
+		}
+		case FCompiledToken::PreUnaryOperator:
+		{
+			if (Operands.Num() < 1)
+			{
+				return MakeError(FText::Format(LOCTEXT("NotEnoughOperands", "EditCondition doesn't have enough operands for operator \"{0}\"."), FText::FromString(Token.Context.GetString())));
+			}
 
-	// INDEX_NONE
-	OperatorJumpTable.MapBinary<FEqual>([](const FPropertyToken& A, const FIndexNoneToken& B, const FEditConditionContext* Context) -> FExpressionResult
-	{
-		return ApplyPropertyIsIndexNone(A, *Context, false);
-	});
+			FOperandResult Result = ApplyPreUnaryOperator(Token, Operands.Last(), Context);
+			if (Result.HasError())
+			{
+				return MakeError(Result.StealError());
+			}
+			Operands.Last() = Result.GetValue();
+			break;
+		}
+		case FCompiledToken::BinaryOperator:
+		{
+			if (Operands.Num() < 2)
+			{
+				return MakeError(FText::Format(LOCTEXT("NotEnoughOperands", "EditCondition doesn't have enough operands for operator \"{0}\"."), FText::FromString(Token.Context.GetString())));
+			}
 
-	OperatorJumpTable.MapBinary<FNotEqual>([](const FPropertyToken& A, const FIndexNoneToken& B, const FEditConditionContext* Context) -> FExpressionResult
-	{
-		return ApplyPropertyIsIndexNone(A, *Context, true);
-	});
+			const FEditConditionOperand B = Operands.Pop();
+			FOperandResult Result = ApplyBinaryOperator(Token, Operands.Last(), B, Context);
+			if (Result.HasError())
+			{
+				return MakeError(Result.StealError());
+			}
+			Operands.Last() = Result.GetValue();
+			break;
+		}
+		case FCompiledToken::Benign:
+			break;
+		default:
+			// edit condition grammar doesn't define post unary or short circuit operators
+			return MakeError(MakeInvalidOperatorError(Token));
+		}
+	}
 
-	// BITWISE AND
-	OperatorJumpTable.MapBinary<FBitwiseAnd>([](const FPropertyToken& A, const FEnumToken& B, const FEditConditionContext* Context) -> FExpressionResult
+	if (Operands.Num() == 1)
 	{
-		return ApplyBitwiseAnd(A, B, *Context);
-	});
+		const FEditConditionOperand& Result = Operands[0];
+		if (Result.Type == FEditConditionOperand::EType::Bool)
+		{
+			return MakeValue(Result.bValue);
+		}
+		if (Result.Type == FEditConditionOperand::EType::Property)
+		{
+			if (TOptional<bool> PropertyValue = Context.GetBoolValue(*Result.Property); PropertyValue.IsSet())
+			{
+				return MakeValue(PropertyValue.GetValue());
+			}
+		}
+	}
 
-	CreateBooleanOperators(OperatorJumpTable);
-	CreateNumberOperators<double>(OperatorJumpTable);
-	CreateEnumOperators(OperatorJumpTable);
+	return MakeError(LOCTEXT("InvalidResult", "EditCondition doesn't evaluate to a bool value."));
 }
 
-TValueOrError<bool, FText> UE::AssetValidation::FEditConditionParser::Evaluate(const FEditConditionExpression& Expression, const UE::AssetValidation::FEditConditionContext& Context) const
+void UE::AssetValidation::FEditConditionParser::ResolveTokens(const FEditConditionExpression& Expression, const UStruct* Struct)
 {
 	using namespace UE::AssetValidation;
-	
-	FExpressionResult Result = ExpressionParser::Evaluate(Expression.Tokens, OperatorJumpTable, &Context);
-	if (Result.HasValue())
+	check(Struct);
+
+	for (const FCompiledToken& Token: Expression.Tokens)
 	{
-		const bool* BoolResult = Result.GetValue().Cast<bool>();
-		if (BoolResult != nullptr)
+		if (const FPropertyToken* PropertyToken = Token.Node.Cast<FPropertyToken>())
 		{
-			return MakeValue(*BoolResult);
+			PropertyToken->Property = Struct->FindPropertyByName(PropertyToken->PropertyName);
 		}
-
-		const FPropertyToken* PropertyResult = Result.GetValue().Cast<FPropertyToken>();
-		if (PropertyResult != nullptr)
+		else if (const FEnumToken* EnumToken = Token.Node.Cast<FEnumToken>())
 		{
-			TOptional<bool> PropertyValue = Context.GetBoolValue(PropertyResult->PropertyName);
-			if (PropertyValue.IsSet())
+			EnumToken->Enum = UClass::TryFindTypeSlow<UEnum>(EnumToken->Type.ToString(), EFindFirstObjectOptions::ExactClass);
+			EnumToken->EnumValue = EnumToken->Enum ? EnumToken->Enum->GetValueByName(EnumToken->Value) : INDEX_NONE;
+			if (EnumToken->EnumValue == INDEX_NONE)
 			{
-				return MakeValue(PropertyValue.GetValue());
+				// leave invalid enum values to be reported by evaluation
+				EnumToken->Enum = nullptr;
 			}
 		}
 	}
-
-	const FText ErrorText = Result.HasError() ? Result.StealError().Text : FText::GetEmpty();
-	return MakeError(ErrorText);
 }
 
 TSharedPtr<UE::AssetValidation::FEditConditionExpression> UE::AssetValidation::FEditConditionParser::Parse(const FString& ExpressionString) const
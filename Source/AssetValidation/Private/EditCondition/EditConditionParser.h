@@ -7,45 +7,42 @@
 #include "Templates/SharedPointer.h"
 #include "Templates/UnrealTemplate.h"
 #include "Templates/ValueOrError.h"
+#include "UObject/NameTypes.h"
 
 class FText;
+class FProperty;
+class UEnum;
+class UStruct;
 
 namespace UE::AssetValidation
 {
 	struct FPropertyToken 
 	{
 		FPropertyToken(FString&& InProperty) :
-			PropertyName(InProperty) {}
+			PropertyName(*InProperty) {}
 
-		FPropertyToken(const FPropertyToken& Other) :
-			PropertyName(Other.PropertyName) {}
+		FPropertyToken(const FPropertyToken& Other) = default;
+		FPropertyToken& operator=(const FPropertyToken& Other) = default;
 
-		FPropertyToken& operator=(const FPropertyToken& Other)
-		{
-			PropertyName = Other.PropertyName;
-			return *this;
-		}
-
-		FString PropertyName;
+		FName PropertyName;
+		/** property resolved for a compiled expression's struct, @see FEditConditionCache */
+		mutable const FProperty* Property = nullptr;
 	};
 
 	struct FEnumToken 
 	{
 		FEnumToken(FString&& InType, FString&& InValue) :
-			Type(InType), Value(InValue) {}
-
-		FEnumToken(const FEnumToken& Other) :
-			Type(Other.Type), Value(Other.Value) {}
+			Type(*InType), Value(*InValue) {}
 
-		FEnumToken& operator=(const FEnumToken& Other)
-		{
-			Type = Other.Type;
-			Value = Other.Value;
-			return *this;
-		}
+		FEnumToken(const FEnumToken& Other) = default;
+		FEnumToken& operator=(const FEnumToken& Other) = default;
 
-		FString Type;
-		FString Value;
+		FName Type;
+		FName Value;
+		/** enum type resolved for a compiled expression, @see FEditConditionCache */
+		mutable const UEnum* Enum = nullptr;
+		/** enum value resolved for a compiled expression, @see FEditConditionCache */
+		mutable int64 EnumValue = INDEX_NONE;
 	};
 
 	struct FNullPtrToken
@@ -122,15 +119,20 @@ public:
 	TSharedPtr<FEditConditionExpression> Parse(const FString& ExpressionString) const;
 
 	/** 
-	 * Evaluate the given expression within the given context.
+	 * Evaluate the given expression within the given context. Evaluation doesn't allocate unless it fails.
 	 * @returns The result of the evaluated expression if valid, invalid TOptional if the evaluation failed or produced a non-bool result.
 	 */
 	TValueOrError<bool, FText> Evaluate(const FEditConditionExpression& Expression, const FEditConditionContext& Context) const;
 
+	/**
+	 * Resolve property and enum tokens of the given expression, so that evaluation doesn't have to look them up by name.
+	 * Expression can only be evaluated for a @Struct it was resolved with.
+	 */
+	static void ResolveTokens(const FEditConditionExpression& Expression, const UStruct* Struct);
+
 private:
 	FTokenDefinitions TokenDefinitions;
 	FExpressionGrammar ExpressionGrammar;
-	TOperatorJumpTable<FEditConditionContext> OperatorJumpTable;
 };
 	
 }
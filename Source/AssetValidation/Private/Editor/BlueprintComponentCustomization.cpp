@@ -207,6 +207,8 @@ void FBlueprintComponentCustomization::SetMetaData(const FName& MetaName, bool b
 		{
 			FBlueprintEditorUtils::RemoveBlueprintVariableMetaData(Blueprint.Get(), VariableName, nullptr, MetaName);
 		}
+		// meta data is changed without blueprint recompile
+		UPropertyValidatorSubsystem::Get()->InvalidateValidationPlans();
 	}
 }
 
@@ -306,6 +306,8 @@ void FBlueprintVariableCustomization::SetMetaData(const FName& MetaName, bool bE
 		{
 			FBlueprintEditorUtils::RemoveBlueprintVariableMetaData(Blueprint.Get(), VariableName, nullptr, MetaName);
 		}
+		// meta data is changed without blueprint recompile
+		UPropertyValidatorSubsystem::Get()->InvalidateValidationPlans();
 
 		if (OnRebuildChildren.IsBound())
 		{
@@ -1,41 +1,78 @@
 #include "MetaDataSource.h"
 
+#include "PropertyValidators/PropertyValidation.h"
+
 namespace UE::AssetValidation
 {
-	
+
+void FMetaDataSource::SetProperty(FProperty* Property)
+{
+	Variant.Set<FProperty*>(Property);
+	ResolveMetaFlags();
+}
+
+void FMetaDataSource::SetExtension(const FPropertyMetaDataExtension& PropertyData)
+{
+	// extension is copied once and then shared between copies of this meta data source
+	Variant.Set<FExtensionRef>(MakeShared<const FPropertyMetaDataExtension>(PropertyData));
+	ResolveMetaFlags();
+}
+
 bool FMetaDataSource::IsValid() const
 {
 	return Variant.GetIndex() != 0;
 }
 
+FMetaDataSource FMetaDataSource::WithImpliedMetaData(const FName& Key) const
+{
+	FMetaDataSource Result{*this};
+	if (const uint8 Flag = GetMetaKeyFlag(Key))
+	{
+		Result.ImpliedFlags |= Flag;
+		Result.MetaFlags |= Flag;
+	}
+	else
+	{
+		Result.ImpliedKeys.AddUnique(Key);
+	}
+	return Result;
+}
+
 FString FMetaDataSource::GetMetaData(const FName& Key) const
 {
+	if (const uint8 Flag = GetMetaKeyFlag(Key); Flag != 0 && (MetaFlags & Flag) == 0)
+	{
+		// interned meta key is not present, skip meta data map lookup
+		return {};
+	}
+
 	if (auto PropertyPtr = Variant.TryGet<FProperty*>())
 	{
 		return (*PropertyPtr)->GetMetaData(Key);
 	}
-	if (auto ExternalData = Variant.TryGet<FPropertyMetaDataExtension>())
+	if (auto ExternalData = Variant.TryGet<FExtensionRef>())
 	{
-		return ExternalData->GetMetaData(Key);
+		return (*ExternalData)->GetMetaData(Key);
 	}
 
 	checkNoEntry();
 	return {};
 }
-	
+
 bool FMetaDataSource::HasMetaData(const FName& Key) const
 {
-	if (auto PropertyPtr = Variant.TryGet<FProperty*>())
+	if (const uint8 Flag = GetMetaKeyFlag(Key))
 	{
-		return (*PropertyPtr)->HasMetaData(Key);
+		check(IsValid());
+		return (MetaFlags & Flag) != 0;
 	}
-	if (auto ExternalData = Variant.TryGet<FPropertyMetaDataExtension>())
+
+	if (ImpliedKeys.Contains(Key))
 	{
-		return ExternalData->HasMetaData(Key);
+		return true;
 	}
 
-	checkNoEntry();
-	return false;
+	return HasSourceMetaData(Key);
 }
 
 void FMetaDataSource::SetMetaData(const FName& Key)
@@ -47,11 +84,16 @@ void FMetaDataSource::SetMetaData(const FName& Key, const FString& Value)
 {
 	if (auto PropertyPtr = Variant.TryGet<FProperty*>())
 	{
-		return (*PropertyPtr)->SetMetaData(Key, *Value);
+		(*PropertyPtr)->SetMetaData(Key, *Value);
+		return ResolveMetaFlags();
 	}
-	if (auto ExternalData = Variant.TryGet<FPropertyMetaDataExtension>())
+	if (auto ExternalData = Variant.TryGet<FExtensionRef>())
 	{
-		return ExternalData->SetMetaData(Key, Value);
+		// copy on write, extension may be shared with other meta data sources
+		TSharedRef<FPropertyMetaDataExtension> Extension = MakeShared<FPropertyMetaDataExtension>(**ExternalData);
+		Extension->SetMetaData(Key, Value);
+		*ExternalData = Extension;
+		return ResolveMetaFlags();
 	}
 	checkNoEntry();
 }
@@ -60,14 +102,66 @@ void FMetaDataSource::RemoveMetaData(const FName& Key)
 {
 	if (auto PropertyPtr = Variant.TryGet<FProperty*>())
 	{
-		return (*PropertyPtr)->RemoveMetaData(Key);
+		(*PropertyPtr)->RemoveMetaData(Key);
+		return ResolveMetaFlags();
 	}
-	if (auto ExternalData = Variant.TryGet<FPropertyMetaDataExtension>())
+	if (auto ExternalData = Variant.TryGet<FExtensionRef>())
 	{
-		return ExternalData->RemoveMetaData(Key);
+		// copy on write, extension may be shared with other meta data sources
+		TSharedRef<FPropertyMetaDataExtension> Extension = MakeShared<FPropertyMetaDataExtension>(**ExternalData);
+		Extension->RemoveMetaData(Key);
+		*ExternalData = Extension;
+		return ResolveMetaFlags();
 	}
 	checkNoEntry();
 }
 
+uint8 FMetaDataSource::GetMetaKeyFlag(const FName& Key)
+{
+	// comparing interned names is cheaper than a single meta data map lookup
+	const TStaticArray<FName, 6>& MetaKeys = GetMetaKeys();
+	for (int32 Index = 0; Index < MetaKeys.Num(); ++Index)
+	{
+		if (MetaKeys[Index] == Key)
+		{
+			return static_cast<uint8>(1 << Index);
+		}
+	}
+	return 0;
+}
+
+void FMetaDataSource::ResolveMetaFlags()
+{
+	MetaFlags = ImpliedFlags;
+	if (!IsValid())
+	{
+		return;
+	}
+
+	const TStaticArray<FName, 6>& MetaKeys = GetMetaKeys();
+	for (int32 Index = 0; Index < MetaKeys.Num(); ++Index)
+	{
+		if (HasSourceMetaData(MetaKeys[Index]))
+		{
+			MetaFlags |= static_cast<uint8>(1 << Index);
+		}
+	}
+}
+
+bool FMetaDataSource::HasSourceMetaData(const FName& Key) const
+{
+	if (auto PropertyPtr = Variant.TryGet<FProperty*>())
+	{
+		return (*PropertyPtr)->HasMetaData(Key);
+	}
+	if (auto ExternalData = Variant.TryGet<FExtensionRef>())
+	{
+		return (*ExternalData)->HasMetaData(Key);
+	}
+
+	checkNoEntry();
+	return false;
+}
+
 }
 
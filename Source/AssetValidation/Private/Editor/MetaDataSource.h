@@ -10,6 +10,9 @@ namespace UE::AssetValidation
  *  Variant structure that represents either property or its extension
  *  Provides access to meta data map for a single property
  *  Not a part of FPropertyValidationContext, because multiple properties may be validated as part of a single context
+ *  Validation meta specifiers (see GetMetaKeys) are resolved once into a bitset when source is set,
+ *  so that HasMetaData for them is a bit test instead of a meta data map lookup.
+ *  Extension is shared between copies, which makes copying a meta data source cheap
  */
 class ASSETVALIDATION_API FMetaDataSource
 {
@@ -17,16 +20,16 @@ public:
 	FMetaDataSource() = default;
 	FMetaDataSource(FProperty* Property)
 	{
-		Variant.Set<FProperty*>(Property);
+		SetProperty(Property);
 	}
 	FMetaDataSource(const FProperty* Property)
 	{
 		// @todo: remove const_cast after everything clears up
-		Variant.Set<FProperty*>(const_cast<FProperty*>(Property)); 
+		SetProperty(const_cast<FProperty*>(Property)); 
 	}
 	FMetaDataSource(const FPropertyMetaDataExtension& Extension)
 	{
-		Variant.Set<FPropertyMetaDataExtension>(Extension);
+		SetExtension(Extension);
 	}
 
 	template <typename T>
@@ -37,22 +40,21 @@ public:
 		return Variant.Get<FProperty*>();
 	}
 
-	FPropertyMetaDataExtension GetExtension() const
+	const FPropertyMetaDataExtension& GetExtension() const
 	{
-		return Variant.Get<FPropertyMetaDataExtension>();
+		return *Variant.Get<FExtensionRef>();
 	}
 
-	void SetProperty(FProperty* Property)
-	{
-		Variant.Set<FProperty*>(Property);
-	}
-
-	void SetExtension(const FPropertyMetaDataExtension& PropertyData)
-	{
-		Variant.Set<FPropertyMetaDataExtension>(PropertyData);
-	}
+	void SetProperty(FProperty* Property);
+	void SetExtension(const FPropertyMetaDataExtension& PropertyData);
 
 	bool IsValid() const;
+
+	/**
+	 * @return meta data source that reports @Key as present, in addition to meta data of this source
+	 * Underlying property or extension is not modified, so the same property can be validated concurrently
+	 */
+	FMetaDataSource WithImpliedMetaData(const FName& Key) const;
 	
 	FString GetMetaData(const FName& Key) const;
 	bool HasMetaData(const FName& Key) const;
@@ -61,7 +63,22 @@ public:
 	void RemoveMetaData(const FName& Key);
 
 private:
-	TVariant<FEmptyVariantState, FProperty*, FPropertyMetaDataExtension> Variant;
+	using FExtensionRef = TSharedRef<const FPropertyMetaDataExtension>;
+
+	/** @return bit of an interned meta key, zero if @Key is not one of the validation meta specifiers */
+	static uint8 GetMetaKeyFlag(const FName& Key);
+	/** resolve interned meta flags from underlying source */
+	void ResolveMetaFlags();
+	/** @return meta data of underlying source, ignoring interned and implied flags */
+	bool HasSourceMetaData(const FName& Key) const;
+
+	TVariant<FEmptyVariantState, FProperty*, FExtensionRef> Variant;
+	/** interned validation meta specifiers present on underlying source or implied */
+	uint8 MetaFlags = 0;
+	/** interned validation meta specifiers implied by WithImpliedMetaData */
+	uint8 ImpliedFlags = 0;
+	/** meta data keys that are not interned and reported as present with empty value, if underlying source doesn't have them */
+	TArray<FName, TInlineAllocator<1>> ImpliedKeys;
 };
 	
 template <>
@@ -73,7 +90,7 @@ FORCEINLINE bool FMetaDataSource::IsType<FProperty>() const
 template <>
 FORCEINLINE bool FMetaDataSource::IsType<FPropertyMetaDataExtension>() const
 {
-	return Variant.IsType<FPropertyMetaDataExtension>();
+	return Variant.IsType<FExtensionRef>();
 }
 
 
@@ -66,6 +66,7 @@ void FPropertyValidationDetailsBuilder::FCustomizationTarget::HandleMetaStateCha
 			{
 				MetaData.RemoveMetaData(MetaKey);
 			}
+			UPropertyValidatorSubsystem::Get()->InvalidateValidationPlans();
 
 #if 0
 			// @todo: this doesn't do anything
@@ -0,0 +1,446 @@
+#include "PackageIntegrityScanner.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/PackageName.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/CoreRedirects.h"
+#include "UObject/ObjectResource.h"
+#include "UObject/Package.h"
+#include "UObject/PackageFileSummary.h"
+#include "UObject/UObjectHash.h"
+
+#define LOCTEXT_NAMESPACE "AssetValidation"
+
+namespace UE::AssetValidation
+{
+/** Size of the first read if package file can't be memory mapped, large enough to fit most package headers */
+static constexpr int64 PackageHeaderReadSize = 64 * 1024;
+
+/**
+ * Reads package header from memory. Names are resolved through package name map, the same way linker does it
+ */
+class FPackageHeaderReader: public FMemoryReaderView
+{
+public:
+	FPackageHeaderReader(TArrayView64<const uint8> InBytes, const FString& InFilename)
+		: FMemoryReaderView(InBytes, true)
+		, Filename(InFilename)
+	{}
+
+	using FMemoryReaderView::operator<<;
+	virtual FArchive& operator<<(FName& Name) override
+	{
+		int32 NameIndex = 0;
+		int32 Number = 0;
+		*this << NameIndex << Number;
+
+		if (NameMap.IsValidIndex(NameIndex))
+		{
+			Name = FName{NameMap[NameIndex], Number};
+		}
+		else
+		{
+			Name = NAME_None;
+			SetError();
+		}
+		return *this;
+	}
+
+	virtual FString GetArchiveName() const override { return Filename; }
+
+	void SetPackageVersions(const FPackageFileSummary& Summary)
+	{
+		SetUEVer(Summary.GetFileVersionUE());
+		SetLicenseeUEVer(Summary.GetFileVersionLicenseeUE());
+		SetEngineVer(Summary.SavedByEngineVersion);
+		SetCustomVersions(Summary.GetCustomVersionContainer());
+		SetFilterEditorOnly((Summary.GetPackageFlags() & PKG_FilterEditorOnly) != 0);
+	}
+
+	TArray<FName> NameMap;
+	const FString& Filename;
+};
+
+/**
+ * Package file bytes, either memory mapped or read from disk. Package header is never read past TotalHeaderSize
+ */
+struct FPackageFileView
+{
+	bool Open(const FString& Filename)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+		if (MappedFile.IsValid())
+		{
+			FileSize = MappedFile->GetFileSize();
+			MappedRegion.Reset(MappedFile->MapRegion(0, FileSize));
+			if (MappedRegion.IsValid())
+			{
+				Bytes = TArrayView64<const uint8>{MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()};
+				return true;
+			}
+
+			MappedFile.Reset();
+		}
+
+		// platform file doesn't support memory mapping, read package header instead
+		FileHandle.Reset(PlatformFile.OpenRead(*Filename));
+		if (!FileHandle.IsValid())
+		{
+			return false;
+		}
+
+		FileSize = FileHandle->Size();
+		return ReadHeader(FMath::Min(FileSize, PackageHeaderReadSize));
+	}
+
+	/** Make sure that package header is accessible */
+	bool RequireHeader(int64 HeaderSize)
+	{
+		if (HeaderSize > FileSize)
+		{
+			return false;
+		}
+
+		return HeaderSize <= Bytes.Num() || ReadHeader(HeaderSize);
+	}
+
+	TArrayView64<const uint8> Bytes;
+	int64 FileSize = 0;
+
+private:
+	bool ReadHeader(int64 HeaderSize)
+	{
+		check(FileHandle.IsValid());
+		Buffer.SetNumUninitialized(HeaderSize);
+		if (!FileHandle->Seek(0) || !FileHandle->Read(Buffer.GetData(), HeaderSize))
+		{
+			return false;
+		}
+
+		Bytes = Buffer;
+		return true;
+	}
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	/** declared after mapped file handle, mapped region has to be destroyed first */
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TUniquePtr<IFileHandle> FileHandle;
+	TArray64<uint8> Buffer;
+};
+
+static bool IsValidPackageIndex(FPackageIndex Index, int32 NumImports, int32 NumExports)
+{
+	return Index.IsNull() || (Index.IsImport() && Index.ToImport() < NumImports) || (Index.IsExport() && Index.ToExport() < NumExports);
+}
+
+static ECoreRedirectFlags GetRedirectFlags(FName ClassName)
+{
+	if (ClassName == NAME_Class)
+	{
+		return ECoreRedirectFlags::Type_Class;
+	}
+	if (ClassName == NAME_ScriptStruct)
+	{
+		return ECoreRedirectFlags::Type_Struct;
+	}
+	if (ClassName == NAME_Enum)
+	{
+		return ECoreRedirectFlags::Type_Enum;
+	}
+	return ECoreRedirectFlags::Type_Object;
+}
+
+FPackageIntegrityScanner::FPackageIntegrityScanner(IAssetRegistry& InAssetRegistry, const FPackageIntegrityScanOptions& InOptions)
+	: AssetRegistry(InAssetRegistry)
+	, Options(InOptions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageIntegrityScanner::GatherScriptObjects, AssetValidationChannel);
+
+	TArray<UPackage*> Packages;
+	ForEachObjectOfClass(UPackage::StaticClass(), [&Packages](UObject* Object)
+	{
+		UPackage* Package = CastChecked<UPackage>(Object);
+		if (Package->HasAnyPackageFlags(PKG_CompiledIn))
+		{
+			Packages.Add(Package);
+		}
+	}, false);
+
+	for (UPackage* Package: Packages)
+	{
+		const FName PackageName = Package->GetFName();
+		ScriptPackages.Add(PackageName);
+
+		ForEachObjectWithPackage(Package, [this, PackageName](UObject* Object)
+		{
+			ScriptObjects.Add(FTopLevelAssetPath{PackageName, Object->GetFName()});
+			return true;
+		}, false);
+	}
+}
+
+bool FPackageIntegrityScanner::DoesPackageExist(FName PackageName) const
+{
+	if (FPackageName::IsScriptPackage(PackageName.ToString()))
+	{
+		if (ScriptPackages.Contains(PackageName))
+		{
+			return true;
+		}
+
+		const FCoreRedirectObjectName Redirected = FCoreRedirects::GetRedirectedName(ECoreRedirectFlags::Type_Package, FCoreRedirectObjectName{NAME_None, NAME_None, PackageName});
+		return ScriptPackages.Contains(Redirected.PackageName);
+	}
+
+	return AssetRegistry.GetAssetPackageDataCopy(PackageName).IsSet();
+}
+
+bool FPackageIntegrityScanner::DoesScriptObjectExist(FName PackageName, FName ObjectName, FName ClassName) const
+{
+	if (ScriptObjects.Contains(FTopLevelAssetPath{PackageName, ObjectName}))
+	{
+		return true;
+	}
+
+	// class default objects may not exist yet, check the class instead
+	FString ObjectString = ObjectName.ToString();
+	if (ObjectString.RemoveFromStart(DEFAULT_OBJECT_PREFIX))
+	{
+		ObjectName = FName{ObjectString};
+		ClassName = NAME_Class;
+
+		if (ScriptObjects.Contains(FTopLevelAssetPath{PackageName, ObjectName}))
+		{
+			return true;
+		}
+	}
+
+	const FCoreRedirectObjectName Redirected = FCoreRedirects::GetRedirectedName(GetRedirectFlags(ClassName), FCoreRedirectObjectName{ObjectName, NAME_None, PackageName});
+	return ScriptObjects.Contains(FTopLevelAssetPath{Redirected.PackageName, Redirected.ObjectName});
+}
+
+bool FPackageIntegrityScanner::ScanPackage(FName PackageName, TArray<FPackageIntegrityIssue>& OutIssues) const
+{
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(PackageName.ToString(), &Filename))
+	{
+		return false;
+	}
+
+	ScanPackageFile(Filename, OutIssues);
+	return true;
+}
+
+void FPackageIntegrityScanner::ScanPackageFile(const FString& Filename, TArray<FPackageIntegrityIssue>& OutIssues) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageIntegrityScanner::ScanPackageFile, AssetValidationChannel);
+
+	auto AddIssue = [&OutIssues](EMessageSeverity::Type Severity, const FText& Message)
+	{
+		OutIssues.Emplace(Severity, Message);
+	};
+
+	FPackageFileView FileView;
+	if (!FileView.Open(Filename))
+	{
+		AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_FailedToOpen", "Failed to open package file {0}."), FText::FromString(Filename)));
+		return;
+	}
+
+	FPackageFileSummary Summary;
+	{
+		FPackageHeaderReader Reader{FileView.Bytes, Filename};
+		Reader << Summary;
+
+		if (Summary.Tag != PACKAGE_FILE_TAG)
+		{
+			AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_BadTag", "Package file has invalid tag, file is either corrupted or not a package."));
+			return;
+		}
+		if (Reader.IsError())
+		{
+			AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_BadSummary", "Failed to read package file summary."));
+			return;
+		}
+	}
+
+	if (Summary.IsFileVersionTooOld())
+	{
+		AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_TooOld", "Package was saved with a file version that is too old to be loaded."));
+		return;
+	}
+	if (Summary.IsFileVersionTooNew())
+	{
+		AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_TooNew", "Package was saved with a newer engine version."));
+		return;
+	}
+	if (Summary.GetPackageFlags() & PKG_FilterEditorOnly)
+	{
+		AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_Cooked", "Package is cooked and can't be loaded by the editor."));
+		return;
+	}
+
+	bool bValidCustomVersions = true;
+	for (const FCustomVersion& CustomVersion: Summary.GetCustomVersionContainer().GetAllVersions())
+	{
+		const TOptional<FCustomVersion> CurrentVersion = FCurrentCustomVersions::Get(CustomVersion.Key);
+		if (!CurrentVersion.IsSet())
+		{
+			AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_UnknownCustomVersion", "Package was saved with an unknown custom version {0}."),
+				FText::FromString(CustomVersion.Key.ToString())));
+			bValidCustomVersions = false;
+		}
+		else if (CustomVersion.Version > CurrentVersion->Version)
+		{
+			AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_NewerCustomVersion", "Package was saved with a newer custom version {0}: {1}, current version is {2}."),
+				FText::FromName(CurrentVersion->GetFriendlyName()), CustomVersion.Version, CurrentVersion->Version));
+			bValidCustomVersions = false;
+		}
+	}
+
+	if (!bValidCustomVersions)
+	{
+		return;
+	}
+
+	if (!FileView.RequireHeader(Summary.TotalHeaderSize))
+	{
+		AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_Truncated", "Package header size {0} exceeds package file size {1}, file is truncated."),
+			Summary.TotalHeaderSize, FileView.FileSize));
+		return;
+	}
+
+	FPackageHeaderReader Reader{FileView.Bytes.Left(Summary.TotalHeaderSize), Filename};
+	Reader.SetPackageVersions(Summary);
+
+	Reader.NameMap.Reserve(Summary.NameCount);
+	Reader.Seek(Summary.NameOffset);
+	for (int32 Index = 0; Index < Summary.NameCount && !Reader.IsError(); ++Index)
+	{
+		FNameEntrySerialized NameEntry{ENAME_LinkerConstructor};
+		Reader << NameEntry;
+		Reader.NameMap.Add(FName{NameEntry});
+	}
+
+	TArray<FObjectImport> ImportMap;
+	ImportMap.SetNum(Summary.ImportCount);
+	Reader.Seek(Summary.ImportOffset);
+	for (int32 Index = 0; Index < Summary.ImportCount && !Reader.IsError(); ++Index)
+	{
+		Reader << ImportMap[Index];
+	}
+
+	TArray<FObjectExport> ExportMap;
+	ExportMap.SetNum(Summary.ExportCount);
+	Reader.Seek(Summary.ExportOffset);
+	for (int32 Index = 0; Index < Summary.ExportCount && !Reader.IsError(); ++Index)
+	{
+		Reader << ExportMap[Index];
+	}
+
+	if (Reader.IsError())
+	{
+		AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_BadTables", "Failed to read package name, import or export map, package header is corrupted."));
+		return;
+	}
+
+	const int32 NumImports = ImportMap.Num();
+	const int32 NumExports = ExportMap.Num();
+
+	for (const FObjectExport& Export: ExportMap)
+	{
+		if (!IsValidPackageIndex(Export.ClassIndex, NumImports, NumExports) || !IsValidPackageIndex(Export.SuperIndex, NumImports, NumExports) ||
+			!IsValidPackageIndex(Export.TemplateIndex, NumImports, NumExports) || !IsValidPackageIndex(Export.OuterIndex, NumImports, NumExports))
+		{
+			AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_BadExport", "Export {0} references an object outside of package import or export map."),
+				FText::FromName(Export.ObjectName)));
+		}
+		else if (Export.SerialOffset < 0 || Export.SerialSize < 0 || Export.SerialOffset + Export.SerialSize > FileView.FileSize)
+		{
+			AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_ExportOutOfFile", "Export {0} data is located outside of package file, file is truncated."),
+				FText::FromName(Export.ObjectName)));
+		}
+	}
+
+	for (const FObjectImport& Import: ImportMap)
+	{
+		if (!IsValidPackageIndex(Import.OuterIndex, NumImports, 0))
+		{
+			AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_BadImport", "Import {0} has an outer outside of package import map."),
+				FText::FromName(Import.ObjectName)));
+			continue;
+		}
+
+		if (Import.bImportOptional)
+		{
+			continue;
+		}
+
+		if (Import.OuterIndex.IsNull())
+		{
+			// import of a package
+			if (!DoesPackageExist(Import.ObjectName))
+			{
+				AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_MissingPackage", "Package imports missing package {0}."),
+					FText::FromName(Import.ObjectName)));
+			}
+			continue;
+		}
+
+		const FObjectImport& Outer = ImportMap[Import.OuterIndex.ToImport()];
+		if (Outer.OuterIndex.IsNull() && FPackageName::IsScriptPackage(Outer.ObjectName.ToString()) && ScriptPackages.Contains(Outer.ObjectName))
+		{
+			// top level import of an existing script package. Missing script packages are reported by package import
+			if (!DoesScriptObjectExist(Outer.ObjectName, Import.ObjectName, Import.ClassName))
+			{
+				AddIssue(EMessageSeverity::Error, FText::Format(LOCTEXT("PackageIntegrity_MissingScriptObject", "Package imports missing {0} {1}.{2}."),
+					FText::FromName(Import.ClassName), FText::FromName(Outer.ObjectName), FText::FromName(Import.ObjectName)));
+			}
+		}
+	}
+
+	if (Options.bCheckSoftReferences && Summary.SoftPackageReferencesCount > 0)
+	{
+		Reader.Seek(Summary.SoftPackageReferencesOffset);
+		for (int32 Index = 0; Index < Summary.SoftPackageReferencesCount && !Reader.IsError(); ++Index)
+		{
+			FName SoftPackageName;
+			Reader << SoftPackageName;
+
+			if (!Reader.IsError() && !SoftPackageName.IsNone() && !DoesPackageExist(SoftPackageName))
+			{
+				AddIssue(Options.SoftReferenceSeverity, FText::Format(LOCTEXT("PackageIntegrity_MissingSoftPackage", "Package soft references missing package {0}."),
+					FText::FromName(SoftPackageName)));
+			}
+		}
+
+		if (Reader.IsError())
+		{
+			AddIssue(EMessageSeverity::Error, LOCTEXT("PackageIntegrity_BadSoftReferences", "Failed to read package soft references, package header is corrupted."));
+		}
+	}
+}
+
+void FPackageIntegrityScanner::ScanPackages(TConstArrayView<FName> PackageNames, TArray<TArray<FPackageIntegrityIssue>>& OutIssues) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageIntegrityScanner::ScanPackages, AssetValidationChannel);
+
+	OutIssues.Reset();
+	OutIssues.SetNum(PackageNames.Num());
+
+	// each package writes only to its own issue list. Package scan is mostly IO bound, so use small batches
+	ParallelFor(TEXT("AssetValidation.ScanPackages"), PackageNames.Num(), 4, [this, &PackageNames, &OutIssues](int32 Index)
+	{
+		ScanPackage(PackageNames[Index], OutIssues[Index]);
+	});
+}
+
+} // UE::AssetValidation
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/TokenizedMessage.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class IAssetRegistry;
+
+namespace UE::AssetValidation
+{
+struct FPackageIntegrityIssue
+{
+	FPackageIntegrityIssue() = default;
+	FPackageIntegrityIssue(EMessageSeverity::Type InSeverity, const FText& InMessage)
+		: Severity(InSeverity)
+		, Message(InMessage)
+	{}
+
+	EMessageSeverity::Type Severity = EMessageSeverity::Error;
+	FText Message;
+};
+
+struct FPackageIntegrityScanOptions
+{
+	/** whether packages referenced by soft references should exist */
+	bool bCheckSoftReferences = true;
+	/** severity of an issue reported for a missing soft referenced package */
+	EMessageSeverity::Type SoftReferenceSeverity = EMessageSeverity::Warning;
+};
+
+/**
+ * Package Integrity Scanner
+ * Reads package file summary, name, import, export and soft package reference maps directly from a package file,
+ * without creating any UObjects. Package files are memory mapped, only package header pages are touched.
+ * Reports:
+ *  - package summaries that can't be loaded by the editor: bad tag, too old or too new file or custom versions, cooked packages
+ *  - malformed import and export maps: out of range indices, exports outside of a package file
+ *  - imports from asset packages that don't exist in the asset registry
+ *  - imports from script packages, classes, structs and enums that don't exist in the running editor, after core redirects
+ *  - soft package references that don't exist in the asset registry
+ *
+ * Scanner is constructed on game thread, scanning is thread safe
+ */
+class FPackageIntegrityScanner
+{
+public:
+	/** Gather script packages and their top level objects. Asset registry should finish loading assets before scanning */
+	FPackageIntegrityScanner(IAssetRegistry& InAssetRegistry, const FPackageIntegrityScanOptions& InOptions = {});
+
+	/**
+	 * Scan a single package file, thread safe
+	 * @return false if package doesn't exist on disk, true otherwise
+	 */
+	bool ScanPackage(FName PackageName, TArray<FPackageIntegrityIssue>& OutIssues) const;
+
+	/** Scan package file by its filename, thread safe. Unreadable file is reported as an issue */
+	void ScanPackageFile(const FString& Filename, TArray<FPackageIntegrityIssue>& OutIssues) const;
+
+	/** Scan multiple packages on worker threads. Issues are reported in package order */
+	void ScanPackages(TConstArrayView<FName> PackageNames, TArray<TArray<FPackageIntegrityIssue>>& OutIssues) const;
+
+private:
+	bool DoesPackageExist(FName PackageName) const;
+	bool DoesScriptObjectExist(FName PackageName, FName ObjectName, FName ClassName) const;
+
+	IAssetRegistry& AssetRegistry;
+	FPackageIntegrityScanOptions Options;
+	/** script packages that exist in the running editor */
+	TSet<FName> ScriptPackages;
+	/** top level objects of script packages: classes, structs, enums, delegate signatures and class default objects */
+	TSet<FTopLevelAssetPath> ScriptObjects;
+};
+
+} // UE::AssetValidation
@@ -0,0 +1,230 @@
+#include "PackageLoadJournal.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetValidationStatics.h"
+#include "Algo/Transform.h"
+#include "HAL/FileManager.h"
+#include "Misc/DataValidation.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace UE::AssetValidation
+{
+static TUniquePtr<FPackageLoadJournal> SharedLoadJournal;
+
+/** @return true if message is logged by package loader itself, rather than by loaded objects */
+static bool IsLoaderCategory(FName Category)
+{
+	static const FName LoaderCategories[] = {TEXT("LogLinker"), TEXT("LogStreaming"), TEXT("LogAsyncLoading"), TEXT("LogUObjectGlobals")};
+	for (const FName& LoaderCategory: LoaderCategories)
+	{
+		if (Category == LoaderCategory)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FPackageLoadJournal* FPackageLoadJournal::Get()
+{
+	return SharedLoadJournal.Get();
+}
+
+void FPackageLoadJournal::Initialize()
+{
+	if (!SharedLoadJournal.IsValid())
+	{
+		SharedLoadJournal = MakeUnique<FPackageLoadJournal>();
+	}
+}
+
+void FPackageLoadJournal::Shutdown()
+{
+	SharedLoadJournal.Reset();
+}
+
+FPackageLoadJournal::FPackageLoadJournal()
+{
+	GLog->AddOutputDevice(this);
+	FCoreUObjectDelegates::OnEndLoadPackage.AddRaw(this, &FPackageLoadJournal::HandleEndLoadPackage);
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FPackageLoadJournal::HandlePostGarbageCollect);
+}
+
+FPackageLoadJournal::~FPackageLoadJournal()
+{
+	FCoreUObjectDelegates::OnEndLoadPackage.RemoveAll(this);
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+	// don't lock critical section, GLog holds a read lock while calling Serialize and RemoveOutputDevice acquires a write lock
+	GLog->RemoveOutputDevice(this);
+}
+
+void FPackageLoadJournal::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	Verbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+	if (Verbosity > ELogVerbosity::Warning)
+	{
+		return;
+	}
+
+	if (IsInAsyncLoadingThread() || (IsInGameThread() && IsLoading()))
+	{
+		FScopeLock Lock{&CriticalSection};
+		PendingMessages.Add(FLoadMessage{V, Verbosity, IsLoaderCategory(Category)});
+	}
+}
+
+void FPackageLoadJournal::HandleEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageLoadJournal::HandleEndLoadPackage, AssetValidationChannel);
+
+	TArray<FLoadMessage> Messages;
+	{
+		FScopeLock Lock{&CriticalSection};
+		Messages = MoveTemp(PendingMessages);
+	}
+
+	TArray<UPackage*, TInlineAllocator<8>> Packages;
+	for (UPackage* Package: Context.LoadedPackages)
+	{
+		if (Package == nullptr || Package->HasAnyPackageFlags(PKG_CompiledIn | PKG_ForDiffing))
+		{
+			continue;
+		}
+
+		const FName PackageName = Package->GetFName();
+		if (FPackageName::IsTempPackage(PackageName.ToString()))
+		{
+			continue;
+		}
+
+		// package is loaded again, previous record is no longer relevant
+		Records.Remove(PackageName);
+		Packages.Add(Package);
+	}
+
+	if (Packages.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<TArray<FLoadMessage>, TInlineAllocator<8>> PackageMessages;
+	PackageMessages.SetNum(Packages.Num());
+
+	TArray<FString, TInlineAllocator<8>> PackageNames;
+	Algo::Transform(Packages, PackageNames, [](const UPackage* Package) { return Package->GetName(); });
+
+	bool bHasUnattributedMessages = false;
+	for (FLoadMessage& Message: Messages)
+	{
+		bool bAttributed = false;
+		for (int32 Index = 0; Index < Packages.Num(); ++Index)
+		{
+			// package name should not be a prefix of a longer package name, e.g. /Game/Hero and /Game/Hero_Old
+			if (MentionsPackage(Message.Message, PackageNames[Index]))
+			{
+				PackageMessages[Index].Add(Message);
+				bAttributed = true;
+			}
+		}
+
+		if (!bAttributed)
+		{
+			// message that doesn't mention a package can be attributed only if it is logged by the loader of a single package.
+			// Other messages may come from anything that logs while package is loading
+			if (Packages.Num() > 1 || !Message.bLoaderMessage)
+			{
+				bHasUnattributedMessages = true;
+				break;
+			}
+
+			PackageMessages[0].Add(MoveTemp(Message));
+		}
+	}
+
+	if (bHasUnattributedMessages)
+	{
+		// can't tell which package produced the message, load validation for these packages has to reload them
+		return;
+	}
+
+	for (int32 Index = 0; Index < Packages.Num(); ++Index)
+	{
+		const FString Filename = Packages[Index]->GetLoadedPath().GetLocalFullPath();
+		if (Filename.IsEmpty())
+		{
+			continue;
+		}
+
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*Filename);
+		if (!StatData.bIsValid)
+		{
+			continue;
+		}
+
+		FPackageLoadRecord& Record = Records.Add(Packages[Index]->GetFName());
+		Record.FileTimestamp = StatData.ModificationTime;
+		Record.FileSize = StatData.FileSize;
+		Record.Messages = MoveTemp(PackageMessages[Index]);
+	}
+}
+
+bool FPackageLoadJournal::ReplayLoadMessages(FName PackageName, const FString& Filename, const FAssetData& AssetData, FDataValidationContext& ValidationContext)
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageLoadJournal::ReplayLoadMessages, AssetValidationChannel);
+
+	FPackageLoadRecord* Record = Records.Find(PackageName);
+	if (Record == nullptr)
+	{
+		return false;
+	}
+
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*Filename);
+	if (!StatData.bIsValid)
+	{
+		return false;
+	}
+
+	if (StatData.ModificationTime == Record->FileTimestamp && StatData.FileSize == Record->FileSize)
+	{
+		if (!Record->FileHash.IsValid())
+		{
+			// file is the same as at load time, remember its hash in case file is touched without content changes
+			Record->FileHash = FMD5Hash::HashFile(*Filename);
+		}
+	}
+	else if (!Record->FileHash.IsValid() || StatData.FileSize != Record->FileSize || FMD5Hash::HashFile(*Filename) != Record->FileHash)
+	{
+		// package file has changed since it was loaded
+		Records.Remove(PackageName);
+		return false;
+	}
+	else
+	{
+		Record->FileTimestamp = StatData.ModificationTime;
+	}
+
+	for (const FLoadMessage& Message: Record->Messages)
+	{
+		const EMessageSeverity::Type Severity = Message.Verbosity == ELogVerbosity::Warning ? EMessageSeverity::Warning : EMessageSeverity::Error;
+		ValidationContext.AddMessage(AssetData, Severity, FText::FromString(Message.Message));
+	}
+
+	return true;
+}
+
+void FPackageLoadJournal::HandlePostGarbageCollect()
+{
+	// messages are replayed only for packages that are in memory, records of unloaded packages are never used again
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		if (FindObjectFast<UPackage>(nullptr, It.Key()) == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+} // UE::AssetValidation
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+class FDataValidationContext;
+struct FAssetData;
+struct FEndLoadPackageContext;
+
+namespace UE::AssetValidation
+{
+/**
+ * Package Load Journal
+ * Records warnings and errors produced by the editor when it loads a package for the first time, along with the package file
+ * state at load time. Load validation replays recorded messages instead of reloading a package that is already in memory,
+ * as long as the package wasn't modified after load and its file on disk is the same.
+ *
+ * Messages are attributed to a package if they mention its name, or if they're logged by the loader while a single package is loading.
+ * If some of the messages can't be attributed, no package from the load request is recorded, so that load validation falls back to reload.
+ * Records are kept only while their packages are in memory
+ */
+class FPackageLoadJournal: public FOutputDevice
+{
+public:
+	/** @return package load journal, nullptr if module is not initialized */
+	static FPackageLoadJournal* Get();
+	static void Initialize();
+	static void Shutdown();
+
+	FPackageLoadJournal();
+	virtual ~FPackageLoadJournal() override;
+
+	//~Begin FOutputDevice interface
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	//~End FOutputDevice interface
+
+	/**
+	 * Append messages recorded for a package to validation context
+	 * @return true if package load was recorded and package file didn't change since load
+	 */
+	bool ReplayLoadMessages(FName PackageName, const FString& Filename, const FAssetData& AssetData, FDataValidationContext& ValidationContext);
+
+private:
+	struct FLoadMessage
+	{
+		FString Message;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Warning;
+		/** whether message is logged by the package loader */
+		bool bLoaderMessage = false;
+	};
+
+	struct FPackageLoadRecord
+	{
+		FDateTime FileTimestamp;
+		int64 FileSize = 0;
+		/** file hash, computed lazily if file timestamp or size doesn't match */
+		FMD5Hash FileHash;
+		TArray<FLoadMessage> Messages;
+	};
+
+	void HandleEndLoadPackage(const FEndLoadPackageContext& Context);
+	void HandlePostGarbageCollect();
+
+	FCriticalSection CriticalSection;
+	/** messages logged while packages were loading, not yet attributed to a package */
+	TArray<FLoadMessage> PendingMessages;
+	/** recorded package loads */
+	TMap<FName, FPackageLoadRecord> Records;
+};
+
+} // UE::AssetValidation
@@ -0,0 +1,147 @@
+#include "PackageVerdictCache.h"
+
+#include "AssetValidationDefines.h"
+#include "PropertyValidationSettings.h"
+#include "PropertyValidators/PropertyValidation.h"
+
+namespace UE::AssetValidation
+{
+void FPackageVerdictCache::Rebuild(const UPropertyValidationSettings& Settings, TConstArrayView<FString> ProjectPackages)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPackageVerdictCache::Rebuild, AssetValidationChannel);
+	FWriteScopeLock WriteLock{Lock};
+
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+	Verdicts.Reset();
+
+	for (const FString& ProjectPackage: ProjectPackages)
+	{
+		AddPrefix(ProjectPackage, ProjectPrefix);
+	}
+	AddPrefix(FString::Printf(TEXT("/Script/%s"), FApp::GetProjectName()), ProjectModulePrefix);
+
+#if WITH_ASSET_VALIDATION_TESTS
+	AddPrefix(TEXT("/Script/AssetValidation"), ProjectPrefix);
+	AddPrefix(TEXT("/AssetValidation"), ProjectPrefix);
+#endif
+
+	for (const FString& PackagePath: Settings.PackagesToIgnore)
+	{
+		AddPrefix(PackagePath, IgnorePrefix);
+	}
+	for (const FString& PackagePath: Settings.PackagesToIterate)
+	{
+		AddPrefix(PackagePath, IteratePrefix);
+	}
+
+	bSkipBlueprintGeneratedClasses = Settings.bSkipBlueprintGeneratedClasses;
+}
+
+EPackageVerdict FPackageVerdictCache::GetVerdict(const UPackage* Package) const
+{
+	const FName PackageName = Package->GetFName();
+	{
+		FReadScopeLock ReadLock{Lock};
+		if (const EPackageVerdict* Verdict = Verdicts.Find(PackageName))
+		{
+			return *Verdict;
+		}
+	}
+
+	FWriteScopeLock WriteLock{Lock};
+	if (const EPackageVerdict* Verdict = Verdicts.Find(PackageName))
+	{
+		return *Verdict;
+	}
+
+	const EPackageVerdict Verdict = ComputeVerdict(PackageName.ToString());
+	Verdicts.Add(PackageName, Verdict);
+
+	return Verdict;
+}
+
+void FPackageVerdictCache::Reset()
+{
+	FWriteScopeLock WriteLock{Lock};
+	Nodes.Empty();
+	Verdicts.Empty();
+}
+
+void FPackageVerdictCache::AddPrefix(FStringView Prefix, uint8 Flags)
+{
+	if (Prefix.IsEmpty())
+	{
+		// empty prefix doesn't match anything, same as FString::StartsWith
+		return;
+	}
+
+	int32 NodeIndex = 0;
+	for (TCHAR Char: Prefix)
+	{
+		Char = FChar::ToLower(Char);
+
+		const FTrieEdge* Edge = Nodes[NodeIndex].Edges.FindByPredicate([Char](const FTrieEdge& Other) { return Other.Char == Char; });
+		if (Edge != nullptr)
+		{
+			NodeIndex = Edge->Node;
+			continue;
+		}
+
+		const int32 ChildIndex = Nodes.AddDefaulted();
+		Nodes[NodeIndex].Edges.Add(FTrieEdge{Char, ChildIndex});
+		NodeIndex = ChildIndex;
+	}
+
+	Nodes[NodeIndex].PrefixFlags |= Flags;
+}
+
+uint8 FPackageVerdictCache::MatchPrefixes(FStringView PackageName) const
+{
+	if (Nodes.IsEmpty())
+	{
+		return 0;
+	}
+
+	uint8 Flags = 0;
+	int32 NodeIndex = 0;
+	for (TCHAR Char: PackageName)
+	{
+		Char = FChar::ToLower(Char);
+
+		const FTrieEdge* Edge = Nodes[NodeIndex].Edges.FindByPredicate([Char](const FTrieEdge& Other) { return Other.Char == Char; });
+		if (Edge == nullptr)
+		{
+			break;
+		}
+
+		NodeIndex = Edge->Node;
+		Flags |= Nodes[NodeIndex].PrefixFlags;
+	}
+
+	return Flags;
+}
+
+EPackageVerdict FPackageVerdictCache::ComputeVerdict(const FString& PackageName) const
+{
+	const uint8 Flags = MatchPrefixes(PackageName);
+
+	EPackageVerdict Verdict = EPackageVerdict::None;
+	// allow validation for project packages, ignore packages from ignore list otherwise
+	if ((Flags & (ProjectPrefix | ProjectModulePrefix)) == 0 && (Flags & IgnorePrefix) != 0)
+	{
+		Verdict |= EPackageVerdict::Ignore;
+	}
+	if ((Flags & (ProjectPrefix | IteratePrefix)) != 0)
+	{
+		Verdict |= EPackageVerdict::Iterate;
+	}
+	if (bSkipBlueprintGeneratedClasses && IsBlueprintGeneratedPackage(PackageName))
+	{
+		Verdict |= EPackageVerdict::Skip;
+	}
+
+	return Verdict;
+}
+
+} // UE::AssetValidation
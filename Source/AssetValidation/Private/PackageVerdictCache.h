@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPropertyValidationSettings;
+
+namespace UE::AssetValidation
+{
+/** Property validation decisions for a package */
+enum class EPackageVerdict: uint8
+{
+	None		= 0,
+	/** package structs and their super structs shouldn't be validated */
+	Ignore		= 1 << 0,
+	/** package structs are skipped, but their super structs are validated */
+	Skip		= 1 << 1,
+	/** all package struct properties are validated, not only those with validation meta data */
+	Iterate		= 1 << 2,
+};
+ENUM_CLASS_FLAGS(EPackageVerdict);
+
+/**
+ * Package Verdict Cache
+ * Package paths from property validation settings and project packages are compiled into a case insensitive prefix trie,
+ * so that package name is matched against all of them in a single pass. Verdict is computed once per package and cached by
+ * package name, which avoids package name allocations and prefix matching for packages that were already seen.
+ * Should be rebuilt each time property validation settings change. Verdict queries are thread safe
+ */
+class FPackageVerdictCache
+{
+public:
+	/** Compile package prefixes from settings and project packages, discard cached verdicts */
+	void Rebuild(const UPropertyValidationSettings& Settings, TConstArrayView<FString> ProjectPackages);
+
+	/** @return verdict for a given package, computed on first request */
+	EPackageVerdict GetVerdict(const UPackage* Package) const;
+
+	/** Discard compiled prefixes and cached verdicts */
+	void Reset();
+
+private:
+	/** prefix kinds stored in trie nodes */
+	enum EPrefixFlags: uint8
+	{
+		/** project package, never ignored and always iterated */
+		ProjectPrefix		= 1 << 0,
+		/** project script module, never ignored */
+		ProjectModulePrefix	= 1 << 1,
+		/** package path from PackagesToIgnore */
+		IgnorePrefix		= 1 << 2,
+		/** package path from PackagesToIterate */
+		IteratePrefix		= 1 << 3,
+	};
+
+	struct FTrieEdge
+	{
+		TCHAR Char;
+		int32 Node;
+	};
+
+	struct FTrieNode
+	{
+		TArray<FTrieEdge, TInlineAllocator<2>> Edges;
+		/** flags of prefixes that end in this node */
+		uint8 PrefixFlags = 0;
+	};
+
+	void AddPrefix(FStringView Prefix, uint8 Flags);
+	/** @return flags of all prefixes that package name starts with */
+	uint8 MatchPrefixes(FStringView PackageName) const;
+	EPackageVerdict ComputeVerdict(const FString& PackageName) const;
+
+	/** trie nodes, root is the first one */
+	TArray<FTrieNode> Nodes;
+	bool bSkipBlueprintGeneratedClasses = false;
+
+	/** verdicts mapped by package name */
+	mutable TMap<FName, EPackageVerdict> Verdicts;
+	mutable FRWLock Lock;
+};
+
+} // UE::AssetValidation
@@ -4,12 +4,54 @@
 #include "PropertyValidationSettings.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "ContainerValidators/ContainerValidator.h"
+#include "EditCondition/EditConditionCache.h"
+#include "EditCondition/EditConditionContext.h"
 #include "Editor/MetaDataSource.h"
 #include "Editor/ValidationEditorExtensionManager.h"
 #include "Engine/ObjectLibrary.h"
 #include "Interfaces/IPluginManager.h"
+#include "PackageVerdictCache.h"
 #include "PropertyValidators/PropertyValidatorBase.h"
 #include "PropertyValidators/PropertyValidation.h"
+#include "StructUtils/InstancedStruct.h"
+#include "UObject/UObjectIterator.h"
+
+namespace UE::AssetValidation
+{
+	/** Compiled validation data for a single property that can be validated */
+	struct FPropertyValidationPlanEntry
+	{
+		FPropertyValidationPlanEntry(const FProperty* InProperty, FMetaDataSource&& InMetaData)
+			: Property(InProperty)
+			, MetaData(MoveTemp(InMetaData))
+		{}
+		
+		const FProperty* Property = nullptr;
+		/** meta data source, either property itself or property extension */
+		FMetaDataSource MetaData;
+		/** property validator that passed CanValidateProperty check, if any */
+		const UPropertyValidatorBase* PropertyValidator = nullptr;
+		/** container validator that passed CanValidateProperty check, if any */
+		const UPropertyValidatorBase* ContainerValidator = nullptr;
+		/** compiled edit condition that should be evaluated for each container, if property has one */
+		TSharedPtr<const FEditConditionExpression> EditCondition;
+		/** whether property has edit condition that should be evaluated for each container */
+		bool bHasEditCondition = false;
+	};
+
+	/**
+	 * Compiled validation plan for a struct. Contains properties of the struct, its super structs and property extensions
+	 * in validation order, but only those that can ever be validated
+	 */
+	struct FStructValidationPlan
+	{
+		TArray<FPropertyValidationPlanEntry> Entries;
+		/** incorrect meta usage found while compiling the plan, reported once by the first validation context that uses the plan */
+		TArray<FString> MetaDataErrors;
+		/** whether meta data errors have been reported. Plan may be shared between worker threads */
+		std::atomic<bool> bMetaDataErrorsReported{false};
+	};
+}
 
 void FPropertyExtensionLibrary::InitializePropertyMap()
 {
@@ -57,17 +99,32 @@ void FPropertyExtensionLibrary::RemoveSet(UPropertyMetaDataExtensionSet* InSet)
 	RequestUpdatePropertyMap();
 }
 
-TConstArrayView<FPropertyMetaDataExtension> FPropertyExtensionLibrary::GetProperties(const UStruct* InStruct) const
+void FPropertyExtensionLibrary::UpdatePropertyMap()
 {
-	FPropertyExtensionLibrary* MutableThis = const_cast<FPropertyExtensionLibrary*>(this);
+	check(IsInGameThread());
 	if (bRequiresUpdate)
 	{
-		MutableThis->RefreshPropertyMap();
-		MutableThis->bRequiresUpdate = false;
+		RefreshPropertyMap();
+		bRequiresUpdate = false;
+	}
+}
+
+TConstArrayView<FPropertyMetaDataExtension> FPropertyExtensionLibrary::GetProperties(const UStruct* InStruct) const
+{
+	// property map is only modified on the game thread, so validation plans can be compiled from worker threads
+	check(!bRequiresUpdate);
+	if (const TArray<FPropertyMetaDataExtension>* Extensions = PropertyExtensionMap.Find(FSoftObjectPath{InStruct}))
+	{
+		return *Extensions;
 	}
 	
-	TConstArrayView<FPropertyMetaDataExtension> Extensions = MutableThis->PropertyExtensionMap.FindOrAdd(FSoftObjectPath{InStruct});
-	return Extensions;
+	return {};
+}
+
+const TMap<FSoftObjectPath, TArray<FPropertyMetaDataExtension>>& FPropertyExtensionLibrary::GetPropertyMap() const
+{
+	check(!bRequiresUpdate);
+	return PropertyExtensionMap;
 }
 
 void FPropertyExtensionLibrary::RefreshPropertyMap()
@@ -102,6 +159,31 @@ void UPropertyValidatorSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	
 	Collection.InitializeDependency<UAssetEditorSubsystem>();
 
+	RegisterValidators();
+	RebuildValidatorDispatch();
+
+	// create and initialize blueprint edito extension manager
+	ExtensionManager = NewObject<UValidationEditorExtensionManager>(this);
+	ExtensionManager->Initialize();
+
+	InitPropertyExtensionLibrary();
+
+	// validation plans hold property pointers and resolved meta data, so they're invalidated each time properties may change
+	GEditor->OnBlueprintCompiled().AddUObject(this, &ThisClass::InvalidateValidationPlans);
+	GEditor->OnBlueprintReinstanced().AddUObject(this, &ThisClass::InvalidateValidationPlans);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddUObject(this, &ThisClass::HandleReloadComplete);
+	UPropertyValidationSettings::GetMutable()->OnSettingChanged().AddUObject(this, &ThisClass::HandleSettingsChanged);
+
+	FModuleManager::Get().OnModulesChanged().AddUObject(this, &ThisClass::HandleModulesChanged);
+
+	PackageVerdicts = MakeShared<UE::AssetValidation::FPackageVerdictCache>();
+	RebuildPackageVerdicts();
+}
+
+bool UPropertyValidatorSubsystem::RegisterValidators()
+{
+	const int32 NumValidators = AllValidators.Num();
+	
 	// cache property validator classes
 	TArray<UClass*> ValidatorClasses;
 	GetDerivedClasses(UPropertyValidatorBase::StaticClass(), ValidatorClasses, true);
@@ -109,8 +191,14 @@ void UPropertyValidatorSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	for (const UClass* ValidatorClass: ValidatorClasses)
 	{
 		// group validators by their base class to speed up property validation
-		if (!ValidatorClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+		if (!ValidatorClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
 		{
+			if (AllValidators.ContainsByPredicate([ValidatorClass](const UPropertyValidatorBase* Validator) { return Validator->GetClass() == ValidatorClass; }))
+			{
+				// validator is already registered
+				continue;
+			}
+			
 			UPropertyValidatorBase* Validator = NewObject<UPropertyValidatorBase>(GetTransientPackage(), ValidatorClass);
 
 			auto& MapContainer = Validator->IsA<UContainerValidator>() ? ContainerValidators : PropertyValidators;
@@ -126,12 +214,60 @@ void UPropertyValidatorSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 		}
 	}
 
-	// create and initialize blueprint edito extension manager
-	ExtensionManager = NewObject<UValidationEditorExtensionManager>(this);
-	ExtensionManager->Initialize();
+	return AllValidators.Num() != NumValidators;
+}
 
-	InitPropertyExtensionLibrary();
+void UPropertyValidatorSubsystem::RebuildValidatorDispatch()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UPropertyValidatorSubsystem_RebuildValidatorDispatch, AssetValidationChannel);
+	
+	FieldClassDispatch.Reset();
+	StructDispatch.Reset();
+
+	for (const FFieldClass* FieldClass: FFieldClass::GetAllFieldClasses())
+	{
+		if (FieldClass->IsChildOf(FProperty::StaticClass()))
+		{
+			// negative results are stored as well, so that lookup never falls back to validator containers
+			FieldClassDispatch.Add(FieldClass, {FindValidator(PropertyValidators, FieldClass), FindValidator(ContainerValidators, FieldClass)});
+		}
+	}
+
+	// gather struct types that have dedicated validators
+	TSet<FName> StructCppTypes;
+	for (const TMap<FPropertyValidatorDescriptor, UPropertyValidatorBase*>* Container: {&PropertyValidators, &ContainerValidators})
+	{
+		for (const auto& [Descriptor, Validator]: *Container)
+		{
+			if (!Descriptor.GetCppType().IsNone())
+			{
+				StructCppTypes.Add(Descriptor.GetCppType());
+			}
+		}
+	}
+
+	if (StructCppTypes.IsEmpty())
+	{
+		return;
+	}
+
+	// resolve struct types by their cpp name once, so that struct properties don't have to build cpp type during validation
+	const FFieldClass* StructPropertyClass = FStructProperty::StaticClass();
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		// only existing names can match validator descriptors
+		const FName CppType{*It->GetStructCPPName(), FNAME_Find};
+		if (!CppType.IsNone() && StructCppTypes.Contains(CppType))
+		{
+			StructDispatch.Add(*It, {FindValidator(PropertyValidators, StructPropertyClass, CppType), FindValidator(ContainerValidators, StructPropertyClass, CppType)});
+		}
+	}
+}
 
+void UPropertyValidatorSubsystem::RebuildPackageVerdicts()
+{
+	ProjectPackages.Reset();
+	
 	const UPropertyValidationSettings* Settings = UPropertyValidationSettings::Get();
 	// if enabled, add project plugins paths to a list of paths to validate by default 
 	if (Settings->bValidateProjectPlugins)
@@ -150,6 +286,8 @@ void UPropertyValidatorSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	{
 		ProjectPackages.Add(FString::Printf(TEXT("/Script/%s"), FApp::GetProjectName()));
 	}
+
+	PackageVerdicts->Rebuild(*Settings, ProjectPackages);
 }
 
 void UPropertyValidatorSubsystem::InitPropertyExtensionLibrary()
@@ -162,11 +300,14 @@ void UPropertyValidatorSubsystem::InitPropertyExtensionLibrary()
 	}
 	
 	ExtensionLibrary.InitializePropertyMap();
+	InvalidateValidationPlans();
+	
 	AssetRegistry.OnInMemoryAssetCreated().AddWeakLambda(this, [this](UObject *Object)
 	{
 		if (UPropertyMetaDataExtensionSet* Set = Cast<UPropertyMetaDataExtensionSet>(Object))
 		{
 			ExtensionLibrary.AddSet(Set);
+			InvalidateValidationPlans();
 		}
 	});
 	AssetRegistry.OnInMemoryAssetDeleted().AddWeakLambda(this, [this](UObject *Object)
@@ -174,11 +315,13 @@ void UPropertyValidatorSubsystem::InitPropertyExtensionLibrary()
 		if (UPropertyMetaDataExtensionSet* Set = Cast<UPropertyMetaDataExtensionSet>(Object))
 		{
 			ExtensionLibrary.RemoveSet(Set);
+			InvalidateValidationPlans();
 		}
 	});
 	UPropertyMetaDataExtensionSet::OnPropertyMetaDataChanged.BindWeakLambda(this, [this]
 	{
 		ExtensionLibrary.RequestUpdatePropertyMap();
+		InvalidateValidationPlans();
 	});
 }
 
@@ -190,7 +333,14 @@ void LazyEmpty(Types&&... Vals)
 
 void UPropertyValidatorSubsystem::Deinitialize()
 {
-	LazyEmpty(PropertyValidators, ContainerValidators, AllValidators);
+	GEditor->OnBlueprintCompiled().RemoveAll(this);
+	GEditor->OnBlueprintReinstanced().RemoveAll(this);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.RemoveAll(this);
+	UPropertyValidationSettings::GetMutable()->OnSettingChanged().RemoveAll(this);
+	FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+	
+	InvalidateValidationPlans();
+	LazyEmpty(PropertyValidators, ContainerValidators, AllValidators, FieldClassDispatch, StructDispatch);
 	
 	ExtensionManager->Cleanup();
 	ExtensionManager = nullptr;
@@ -198,10 +348,59 @@ void UPropertyValidatorSubsystem::Deinitialize()
 	ExtensionLibrary.Reset();
 
 	ProjectPackages.Empty();
+	PackageVerdicts->Reset();
 	
 	Super::Deinitialize();
 }
 
+void UPropertyValidatorSubsystem::PostChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
+{
+	if (Info != FStructureEditorUtils::DefaultValueChanged)
+	{
+		InvalidateValidationPlans();
+	}
+}
+
+void UPropertyValidatorSubsystem::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+	// reloaded modules may add new validator classes or struct types
+	RegisterValidators();
+	RebuildValidatorDispatch();
+	InvalidateValidationPlans();
+}
+
+void UPropertyValidatorSubsystem::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	// loaded module may contain new property validator classes
+	if (Reason == EModuleChangeReason::ModuleLoaded && RegisterValidators())
+	{
+		RebuildValidatorDispatch();
+		// compiled validation plans hold validators resolved by validator dispatch
+		InvalidateValidationPlans();
+	}
+}
+
+void UPropertyValidatorSubsystem::HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RebuildPackageVerdicts();
+	InvalidateValidationPlans();
+}
+
+void UPropertyValidatorSubsystem::InvalidateValidationPlans()
+{
+	// property extensions are merged into validation plans, update them before plans are compiled again
+	ExtensionLibrary.UpdatePropertyMap();
+	
+	{
+		FWriteScopeLock WriteLock{ValidationPlanLock};
+		// plans that are currently in use are kept alive by shared references
+		ValidationPlans.Empty();
+	}
+	
+	// compiled edit conditions reference properties and metadata of invalidated plans
+	UE::AssetValidation::FEditConditionCache::Get().Invalidate();
+}
+
 FPropertyValidationResult UPropertyValidatorSubsystem::ValidateObject(const UObject* Object) const
 {
 	if (!IsValid(Object))
@@ -225,7 +424,7 @@ FPropertyValidationResult UPropertyValidatorSubsystem::ValidateObject(const UObj
 	return ValidationContext.MakeValidationResult();
 }
 
-FPropertyValidationResult UPropertyValidatorSubsystem::ValidateStruct(const UObject* OwningObject, const UScriptStruct* ScriptStruct, const uint8* StructData)
+FPropertyValidationResult UPropertyValidatorSubsystem::ValidateStruct(const UObject* OwningObject, const UScriptStruct* ScriptStruct, const uint8* StructData) const
 {
 	if (!IsValid(OwningObject) || ScriptStruct == nullptr || StructData == nullptr)
 	{
@@ -242,6 +441,81 @@ FPropertyValidationResult UPropertyValidatorSubsystem::ValidateStruct(const UObj
 	return ValidationContext.MakeValidationResult();
 }
 
+TConstArrayView<FPropertyMetaDataExtension> UPropertyValidatorSubsystem::GetPropertyExtensions(const UStruct* Struct) const
+{
+	return ExtensionLibrary.GetProperties(Struct);
+}
+
+const TMap<FSoftObjectPath, TArray<FPropertyMetaDataExtension>>& UPropertyValidatorSubsystem::GetPropertyExtensionMap() const
+{
+	return ExtensionLibrary.GetPropertyMap();
+}
+
+bool UPropertyValidatorSubsystem::CanValidateStructOffGameThread(const UStruct* Struct) const
+{
+	if (Struct == nullptr)
+	{
+		return true;
+	}
+
+	TSet<const UStruct*> VisitedStructs;
+	TArray<const UStruct*, TInlineAllocator<8>> PendingStructs{Struct};
+	VisitedStructs.Add(Struct);
+	
+	while (!PendingStructs.IsEmpty())
+	{
+		TSharedRef<UE::AssetValidation::FStructValidationPlan> Plan = GetValidationPlan(PendingStructs.Pop());
+		for (const UE::AssetValidation::FPropertyValidationPlanEntry& Entry: Plan->Entries)
+		{
+			// unwrap container properties, validation meta of a container applies to its elements
+			TArray<const FProperty*, TInlineAllocator<2>> ValueProperties;
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Entry.Property))
+			{
+				ValueProperties.Add(ArrayProperty->Inner);
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Entry.Property))
+			{
+				ValueProperties.Add(SetProperty->ElementProp);
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Entry.Property))
+			{
+				ValueProperties.Add(MapProperty->KeyProp);
+				ValueProperties.Add(MapProperty->ValueProp);
+			}
+			else
+			{
+				ValueProperties.Add(Entry.Property);
+			}
+
+			for (const FProperty* ValueProperty: ValueProperties)
+			{
+				if (ValueProperty->IsA<FObjectPropertyBase>() && Entry.MetaData.HasMetaData(UE::AssetValidation::ValidateRecursive))
+				{
+					return false;
+				}
+				
+				if (const FStructProperty* StructProperty = CastField<FStructProperty>(ValueProperty))
+				{
+					// instanced struct payload type is known only at runtime, its validation plan may be compiled on a worker thread
+					if (StructProperty->Struct->IsChildOf(TBaseStructure<FInstancedStruct>::Get()))
+					{
+						return false;
+					}
+					
+					bool bAlreadyVisited = false;
+					VisitedStructs.Add(StructProperty->Struct, &bAlreadyVisited);
+					if (!bAlreadyVisited)
+					{
+						PendingStructs.Add(StructProperty->Struct);
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 FPropertyValidationResult UPropertyValidatorSubsystem::ValidateObjectProperty(const UObject* Object, const FProperty* Property) const
 {
 	if (!IsValid(Object) || Property == nullptr)
@@ -296,97 +570,77 @@ FPropertyValidationResult UPropertyValidatorSubsystem::ValidateStructProperty(co
 
 bool UPropertyValidatorSubsystem::ShouldIgnorePackage(const UPackage* Package) const
 {
-	const FString PackageName = Package->GetName();
-
-	// allow validation for project packages
-	if (ProjectPackages.ContainsByPredicate([&PackageName](const FString& ProjectPackage)
-	{
-		return PackageName.StartsWith(ProjectPackage);
-	}))
-	{
-		return false;
-	}
-	
-	const FString ProjectPackage = FString::Printf(TEXT("/Script/%s"), FApp::GetProjectName());
-	if (PackageName.StartsWith(ProjectPackage))
-	{
-		return false;
-	}
-	
-#if WITH_ASSET_VALIDATION_TESTS
-	if (PackageName.StartsWith("/Script/AssetValidation") || PackageName.StartsWith("/AssetValidation"))
-	{
-		return false;
-	}
-#endif
-
-	const auto Settings = UPropertyValidationSettings::Get();
-	// package is blueprint generated if it is either in Content folder or Plugins/Content folder
-	return Settings->PackagesToIgnore.ContainsByPredicate([&PackageName](const FString& ModulePath)
-	{
-		return PackageName.StartsWith(ModulePath);
-	});
+	return EnumHasAnyFlags(PackageVerdicts->GetVerdict(Package), UE::AssetValidation::EPackageVerdict::Ignore);
 }
 
 bool UPropertyValidatorSubsystem::ShouldIteratePackageProperties(const UPackage* Package) const
 {
-	const FString PackageName = Package->GetName();
-
-	// allow validation for project packages
-	if (ProjectPackages.ContainsByPredicate([&PackageName](const FString& ProjectPackage)
-	{
-		return PackageName.StartsWith(ProjectPackage);
-	}))
-	{
-		return true;
-	}
-	
-#if WITH_ASSET_VALIDATION_TESTS
-	if (PackageName.StartsWith("/Script/AssetValidation") || PackageName.StartsWith("/AssetValidation"))
-	{
-		return true;
-	}
-#endif
-	
-	auto Settings = UPropertyValidationSettings::Get();
-	return Settings->PackagesToIterate.ContainsByPredicate([PackageName](const FString& ModulePath)
-	{
-		return PackageName.StartsWith(ModulePath);
-	});
+	return EnumHasAnyFlags(PackageVerdicts->GetVerdict(Package), UE::AssetValidation::EPackageVerdict::Iterate);
 }
 
 bool UPropertyValidatorSubsystem::ShouldSkipPackage(const UPackage* Package) const
 {
-	auto Settings = UPropertyValidationSettings::Get();
-	return Settings->bSkipBlueprintGeneratedClasses && UE::AssetValidation::IsBlueprintGeneratedPackage(Package->GetName());
+	return EnumHasAnyFlags(PackageVerdicts->GetVerdict(Package), UE::AssetValidation::EPackageVerdict::Skip);
 }
 
 bool UPropertyValidatorSubsystem::HasValidatorForPropertyType(const FProperty* PropertyType) const
 {
+	const UE::AssetValidation::FPropertyValidatorDispatch* Dispatch = FindValidatorDispatch(PropertyType);
+	if (Dispatch == nullptr)
+	{
+		return false;
+	}
+	
 	// attempt to find property validator for given property type
-	if (FindPropertyValidator(PropertyType) != nullptr)
+	if (Dispatch->PropertyValidator != nullptr)
 	{
 		return true;
 	}
 	
-	if (!UE::AssetValidation::IsContainerProperty(PropertyType))
+	// if we failed to find a property validator for a given property type, it is probably a struct and we can't validate the value.
+	// Validate means "validate container data" for other "containers", while for "object" and "struct" container validate means the value itself
+	return UE::AssetValidation::IsContainerProperty(PropertyType) && Dispatch->ContainerValidator != nullptr;
+}
+
+void UPropertyValidatorSubsystem::ValidateContainerWithContext(TNonNullPtr<const uint8> ContainerMemory, const UStruct* Struct, FPropertyValidationContext& ValidationContext) const
+{
+	TSharedRef<UE::AssetValidation::FStructValidationPlan> Plan = GetValidationPlan(Struct);
+	if (!Plan->MetaDataErrors.IsEmpty() && !Plan->bMetaDataErrorsReported.exchange(true))
 	{
-		// if we failed to find a property validator for a given property type, it is probably a struct and we can't validate the value.
-		// Validate means "validate container data" for other "containers", while for "object" and "struct" container validate means the value itself
-		return false;
+		// plans are recompiled when meta data or settings change, so errors are reported again only if they are still relevant
+		ValidationContext.ReportMetaDataErrors(Plan->MetaDataErrors);
 	}
 	
-	// property type is a container
-	if (FindContainerValidator(PropertyType) != nullptr)
+	for (UE::AssetValidation::FPropertyValidationPlanEntry& Entry: Plan->Entries)
 	{
-		return true;
+		ValidatePlanEntryWithContext(ContainerMemory, Entry, ValidationContext);
 	}
+}
 
-	return false;
+TSharedRef<UE::AssetValidation::FStructValidationPlan> UPropertyValidatorSubsystem::GetValidationPlan(const UStruct* Struct) const
+{
+	const TObjectKey<UStruct> StructKey{Struct};
+	{
+		FReadScopeLock ReadLock{ValidationPlanLock};
+		if (const TSharedPtr<UE::AssetValidation::FStructValidationPlan>* Plan = ValidationPlans.Find(StructKey))
+		{
+			return Plan->ToSharedRef();
+		}
+	}
+
+	TSharedRef<UE::AssetValidation::FStructValidationPlan> Plan = CompileValidationPlan(Struct);
+	
+	FWriteScopeLock WriteLock{ValidationPlanLock};
+	// plan may have been compiled by another thread in the meantime
+	return ValidationPlans.FindOrAdd(StructKey, Plan).ToSharedRef();
 }
 
-void UPropertyValidatorSubsystem::ValidateContainerWithContext(TNonNullPtr<const uint8> ContainerMemory, const UStruct* Struct, FPropertyValidationContext& ValidationContext) const
+TSharedRef<UE::AssetValidation::FStructValidationPlan> UPropertyValidatorSubsystem::CompileValidationPlan(const UStruct* Struct) const
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UPropertyValidatorSubsystem_CompileValidationPlan, AssetValidationChannel);
+	
+	TSharedRef<UE::AssetValidation::FStructValidationPlan> Plan = MakeShared<UE::AssetValidation::FStructValidationPlan>();
+	
 	const bool bIsScriptStruct = Cast<UScriptStruct>(Struct) != nullptr;
 	const UPackage* Package = Struct->GetPackage();
 	
@@ -403,17 +657,18 @@ void UPropertyValidatorSubsystem::ValidateContainerWithContext(TNonNullPtr<const
 			// EFieldIterationFlags::None because we look only at this Struct properties
 			for (FProperty* Property: TFieldRange<FProperty>(Struct, EFieldIterationFlags::None))
 			{
-				UE::AssetValidation::FMetaDataSource MetaData{Property};
-				ValidatePropertyWithContext(ContainerMemory, Property, MetaData, ValidationContext);
+				AddValidationPlanEntry(*Plan, Property, UE::AssetValidation::FMetaDataSource{Property});
 			}
 		}
 
-		// query property extensions for current Struct and run validation on them
+		// query property extensions for current Struct and add them to the plan
 		check(ExtensionLibrary.IsInitialized());
 		for (const FPropertyMetaDataExtension& Extension: ExtensionLibrary.GetProperties(Struct))
 		{
-			UE::AssetValidation::FMetaDataSource MetaData{Extension};
-			ValidatePropertyWithContext(ContainerMemory, Extension.GetProperty(), MetaData, ValidationContext);
+			if (const FProperty* Property = Extension.GetProperty())
+			{
+				AddValidationPlanEntry(*Plan, Property, UE::AssetValidation::FMetaDataSource{Extension});
+			}
 		}
 		
 		Struct = Struct->GetSuperStruct();
@@ -422,6 +677,88 @@ void UPropertyValidatorSubsystem::ValidateContainerWithContext(TNonNullPtr<const
 			Package = Struct->GetPackage();
 		}
 	}
+
+	Plan->Entries.Shrink();
+	return Plan;
+}
+
+void UPropertyValidatorSubsystem::AddValidationPlanEntry(UE::AssetValidation::FStructValidationPlan& Plan, const FProperty* Property, UE::AssetValidation::FMetaDataSource&& MetaData) const
+{
+	if (UPropertyValidationSettings::Get()->bReportIncorrectMetaUsage)
+	{
+		// check whether metadata is valid. Errors are stored in the plan, as plan is compiled once and used by many validation contexts
+		UE::AssetValidation::CheckPropertyMetaData(Property, MetaData, Plan.MetaDataErrors);
+	}
+
+	// check whether we can validate property at all
+	if (!ShouldEverValidateProperty(Property, MetaData))
+	{
+		return;
+	}
+
+	const UPropertyValidatorBase* PropertyValidator = FindPropertyValidator(Property);
+	if (PropertyValidator && !PropertyValidator->CanValidateProperty(Property, MetaData))
+	{
+		PropertyValidator = nullptr;
+	}
+
+	const UPropertyValidatorBase* ContainerValidator = FindContainerValidator(Property);
+	if (ContainerValidator && !ContainerValidator->CanValidateProperty(Property, MetaData))
+	{
+		ContainerValidator = nullptr;
+	}
+
+	if (PropertyValidator == nullptr && ContainerValidator == nullptr)
+	{
+		return;
+	}
+
+	UE::AssetValidation::FPropertyValidationPlanEntry& Entry = Plan.Entries.Emplace_GetRef(Property, MoveTemp(MetaData));
+	Entry.PropertyValidator = PropertyValidator;
+	Entry.ContainerValidator = ContainerValidator;
+	Entry.bHasEditCondition = Property->HasMetaData(TEXT("EditCondition"));
+	if (Entry.bHasEditCondition)
+	{
+		Entry.EditCondition = UE::AssetValidation::FEditConditionCache::Get().FindOrCompile(Property->GetOwnerStruct(), Property);
+	}
+}
+
+void UPropertyValidatorSubsystem::ValidatePlanEntryWithContext(TNonNullPtr<const uint8> ContainerMemory, UE::AssetValidation::FPropertyValidationPlanEntry& Entry, FPropertyValidationContext& ValidationContext) const
+{
+	const FProperty* Property = Entry.Property;
+	if (!ShouldValidatePropertyInContext(Property, Entry.MetaData, ValidationContext))
+	{
+		return;
+	}
+
+	if (Entry.bHasEditCondition)
+	{
+		// property with invalid edit condition never passes it
+		if (!Entry.EditCondition.IsValid())
+		{
+			return;
+		}
+
+		UE::AssetValidation::FEditConditionContext Context{Property->GetOwnerStruct(), ContainerMemory, Property};
+		TValueOrError<bool, FText> Result = UE::AssetValidation::FEditConditionCache::Get().Evaluate(*Entry.EditCondition, Context);
+		if (!Result.HasValue() || Result.GetValue() == false)
+		{
+			return;
+		}
+	}
+	
+	TNonNullPtr<const uint8> PropertyMemory{Property->ContainerPtrToValuePtr<uint8>(ContainerMemory)};
+	// validate property value
+	if (Entry.PropertyValidator)
+	{
+		Entry.PropertyValidator->ValidateProperty(PropertyMemory, Property, Entry.MetaData, ValidationContext);
+	}
+
+	// validate property as a container
+	if (Entry.ContainerValidator)
+	{
+		Entry.ContainerValidator->ValidateProperty(PropertyMemory, Property, Entry.MetaData, ValidationContext);
+	}
 }
 
 void UPropertyValidatorSubsystem::ValidatePropertyWithContext(TNonNullPtr<const uint8> ContainerMemory, const FProperty* Property, FMetaDataSource& MetaData, FPropertyValidationContext& ValidationContext) const
@@ -501,6 +838,11 @@ bool UPropertyValidatorSubsystem::CanEverValidateProperty(const FProperty* Prope
 }
 
 bool UPropertyValidatorSubsystem::ShouldValidateProperty(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData, FPropertyValidationContext& ValidationContext) const
+{
+	return ShouldEverValidateProperty(Property, MetaData) && ShouldValidatePropertyInContext(Property, MetaData, ValidationContext);
+}
+
+bool UPropertyValidatorSubsystem::ShouldEverValidateProperty(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData) const
 {
 	if (!CanEverValidateProperty(Property))
 	{
@@ -531,6 +873,11 @@ bool UPropertyValidatorSubsystem::ShouldValidateProperty(const FProperty* Proper
 		}
 	}
 
+	return true;
+}
+
+bool UPropertyValidatorSubsystem::ShouldValidatePropertyInContext(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData, FPropertyValidationContext& ValidationContext) const
+{
 	const UObject* SourceObject = ValidationContext.GetSourceObject();
 	const bool bAsset = UE::AssetValidation::IsAssetOrAssetFragment(SourceObject);
 	
@@ -567,25 +914,39 @@ bool UPropertyValidatorSubsystem::ShouldValidateProperty(const FProperty* Proper
 	return true;
 }
 
+const UE::AssetValidation::FPropertyValidatorDispatch* UPropertyValidatorSubsystem::FindValidatorDispatch(const FProperty* PropertyType) const
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(PropertyType))
+	{
+		if (const UE::AssetValidation::FPropertyValidatorDispatch* Dispatch = StructDispatch.Find(StructProperty->Struct))
+		{
+			return Dispatch;
+		}
+	}
+
+	return FieldClassDispatch.Find(PropertyType->GetClass());
+}
+
 const UPropertyValidatorBase* UPropertyValidatorSubsystem::FindPropertyValidator(const FProperty* PropertyType) const
 {
-	return FindValidator(PropertyValidators, PropertyType);
+	const UE::AssetValidation::FPropertyValidatorDispatch* Dispatch = FindValidatorDispatch(PropertyType);
+	return Dispatch ? Dispatch->PropertyValidator : nullptr;
 }
 
 const UPropertyValidatorBase* UPropertyValidatorSubsystem::FindContainerValidator(const FProperty* PropertyType) const
 {
-	return FindValidator(ContainerValidators, PropertyType);
+	const UE::AssetValidation::FPropertyValidatorDispatch* Dispatch = FindValidatorDispatch(PropertyType);
+	return Dispatch ? Dispatch->ContainerValidator : nullptr;
 }
 
-const UPropertyValidatorBase* UPropertyValidatorSubsystem::FindValidator(const TMap<FPropertyValidatorDescriptor, UPropertyValidatorBase*>& Container, const FProperty* PropertyType)
+const UPropertyValidatorBase* UPropertyValidatorSubsystem::FindValidator(const TMap<FPropertyValidatorDescriptor, UPropertyValidatorBase*>& Container, const FFieldClass* PropertyClass, FName CppType)
 {
 	check(!Container.IsEmpty()); // we don't expect validator container to be empty, so this is probably a bug
 	
-	const FFieldClass* PropertyClass = PropertyType->GetClass();
 	// find suitable validator for property value
-	if (PropertyType->IsA<FStructProperty>())
+	if (!CppType.IsNone())
 	{
-		FPropertyValidatorDescriptor Descriptor{PropertyType->GetClass(), FName{PropertyType->GetCPPType()}};
+		FPropertyValidatorDescriptor Descriptor{PropertyClass, CppType};
 		if (auto ValidatorPtr = Container.Find(Descriptor))
 		{
 			return *ValidatorPtr;
@@ -2,8 +2,10 @@
 
 #include "AssetValidationDefines.h"
 #include "PropertyValidatorSubsystem.h"
+#include "PropertyValidators/SoftReferenceResolver.h"
 #include "BehaviorTree/BTNode.h"
 #include "Components/Widget.h"
+#include "EditCondition/EditConditionCache.h"
 #include "EditCondition/EditConditionContext.h"
 #include "EditCondition/EditConditionParser.h"
 #include "Editor/MetaDataSource.h"
@@ -70,18 +72,16 @@ bool ApplyToNonContainerProperty(const FProperty* Property, TPropPred&& Func)
 
 bool UE::AssetValidation::PassesEditCondition(UStruct* Struct, TNonNullPtr<const uint8> Container, const FProperty* Property)
 {
-	const FString EditConditionString = Property->GetMetaData(TEXT("EditCondition"));
-	if (EditConditionString.IsEmpty())
+	if (!Property->HasMetaData(TEXT("EditCondition")))
 	{
 		return true;
 	}
 
-	static UE::AssetValidation::FEditConditionParser Parser;
-	
-	if (TSharedPtr<UE::AssetValidation::FEditConditionExpression> Expression = Parser.Parse(EditConditionString))
+	FEditConditionCache& Cache = FEditConditionCache::Get();
+	if (TSharedPtr<const FEditConditionExpression> Expression = Cache.FindOrCompile(Struct, Property))
 	{
 		FEditConditionContext Context{Struct, Container, Property};
-		if (auto Result = Parser.Evaluate(*Expression, Context); Result.HasValue())
+		if (auto Result = Cache.Evaluate(*Expression, Context); Result.HasValue())
 		{
 			return Result.GetValue();
 		}
@@ -108,57 +108,68 @@ bool UE::AssetValidation::CheckPropertyMetaData(const FProperty* Property, const
 	{
 		return *Found;
 	}
+
+	TArray<FString> Errors;
+	const bool bPropertyValid = CheckPropertyMetaData(Property, MetaData, Errors);
+	for (const FString& Error: Errors)
+	{
+		UE_CLOG(bLoggingEnabled, LogAssetValidation, Error, TEXT("%s"), *Error);
+	}
+
+	CheckedProperties.Add(Property, bPropertyValid);
 	
+	return bPropertyValid;
+}
+
+bool UE::AssetValidation::CheckPropertyMetaData(const FProperty* Property, const FMetaDataSource& MetaData, TArray<FString>& OutErrors)
+{
 	const FString Pattern{TEXT("{0} : {1} property type does not support \"{2}\" meta specifier. Please update source code to fix incorrect meta usage.")};
 	
 	const FString CppPropertyName = GetNameSafe(Property->GetOwnerUObject()) + TEXT(".") + Property->GetNameCPP();
 	const FString CppType = Property->GetCPPType();
 
 	bool bPropertyValid = true;
+	auto CheckMeta = [&](const FName& MetaName, bool bMetaAllowed)
+	{
+		if (!bMetaAllowed)
+		{
+			OutErrors.Add(FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
+		}
+		bPropertyValid &= bMetaAllowed;
+	};
+
 	{
 		const FName MetaName = UE::AssetValidation::Validate;
 		// check "Validate" meta specifier
 		const bool bUsedOnStructProperty = ApplyToNonContainerProperty(Property, [](const FProperty* Property) { return Property->IsA<FStructProperty>(); });
 		// struct properties can have "Validate" meta all they want, even if struct value validator doesn't exist
-		const bool bMetaAllowed = !MetaData.HasMetaData(MetaName) || bUsedOnStructProperty || CanApplyMeta_Validate(Property);
-		UE_CLOG(!bMetaAllowed, LogAssetValidation, Error, TEXT("%s"), *FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
-		bPropertyValid &= bMetaAllowed;
+		CheckMeta(MetaName, !MetaData.HasMetaData(MetaName) || bUsedOnStructProperty || CanApplyMeta_Validate(Property));
 	}
 
 	{
 		const FName MetaName = UE::AssetValidation::ValidateKey;
 		// check "ValidateKey" meta specifier
-		const bool bMetaAllowed = !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateKey(Property);
-		UE_CLOG(!bMetaAllowed && bLoggingEnabled, LogAssetValidation, Error, TEXT("%s"), *FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
-		bPropertyValid &= bMetaAllowed;
+		CheckMeta(MetaName, !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateKey(Property));
 	}
 
 	{
 		const FName MetaName = UE::AssetValidation::ValidateValue;
 		// check "ValidateValue" meta specifier
-		const bool bMetaAllowed = !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateValue(Property);
-		UE_CLOG(!bMetaAllowed && bLoggingEnabled, LogAssetValidation, Error, TEXT("%s"), *FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
-		bPropertyValid &= bMetaAllowed;
+		CheckMeta(MetaName, !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateValue(Property));
 	}
 
 	{
 		const FName MetaName = UE::AssetValidation::ValidateRecursive;
 		// check "ValidateRecursive" meta specifier
-		const bool bMetaAllowed = !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateRecursive(Property);
-		UE_CLOG(!bMetaAllowed && bLoggingEnabled, LogAssetValidation, Error, TEXT("%s"), *FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
-		bPropertyValid &= bMetaAllowed;
+		CheckMeta(MetaName, !MetaData.HasMetaData(MetaName) || CanApplyMeta_ValidateRecursive(Property));
 	}
 
 	{
 		const FName MetaName = UE::AssetValidation::FailureMessage;
 		// check "FailureMessage" meta specifier
-		const bool bMetaAllowed = !MetaData.HasMetaData(MetaName) || CanApplyMeta(Property, MetaName);
-		UE_CLOG(!bMetaAllowed && bLoggingEnabled, LogAssetValidation, Error, TEXT("%s"), *FString::Format(*Pattern, {CppPropertyName, CppType, MetaName.ToString()}));
-		bPropertyValid &= bMetaAllowed;
+		CheckMeta(MetaName, !MetaData.HasMetaData(MetaName) || CanApplyMeta(Property, MetaName));
 	}
 
-	CheckedProperties.Add(Property, bPropertyValid);
-	
 	return bPropertyValid;
 }
 
@@ -298,6 +309,11 @@ FString UE::AssetValidation::GetPropertyTypeName(const FProperty* Property)
 }
 
 FString UE::AssetValidation::ResolveObjectDisplayName(const UObject* Object, FPropertyValidationContext& ValidationContext)
+{
+	return ResolveObjectDisplayName(Object);
+}
+
+FString UE::AssetValidation::ResolveObjectDisplayName(const UObject* Object)
 {
 	if (const UBTNode* BTNode = Cast<UBTNode>(Object))
 	{
@@ -328,12 +344,14 @@ bool UE::AssetValidation::UpdateBlueprintVarMetaData(UBlueprint* Blueprint, cons
 		if ((bAddIfPossible && !bHasMetaData) || bHasMetaData)
 		{
 			FBlueprintEditorUtils::SetBlueprintVariableMetaData(Blueprint, VarName, nullptr, MetaName, {});
+			UPropertyValidatorSubsystem::Get()->InvalidateValidationPlans();
 		}
 		return true;
 	}
 	else if (bHasMetaData)
 	{
 		FBlueprintEditorUtils::RemoveBlueprintVariableMetaData(Blueprint, VarName, nullptr, MetaName);
+		UPropertyValidatorSubsystem::Get()->InvalidateValidationPlans();
 	}
 
 	return false;
@@ -360,58 +378,86 @@ FPropertyValidationContext::FPropertyValidationContext(const UPropertyValidatorS
 	// explicitly exclude last outer, as it is probably a context that user can understand (blueprint, map, etc.)
 	for (int32 Index = Outers.Num() - 2; Index >= 0; --Index)
 	{
-		PushPrefix(GetBeautifiedName(Outers[Index]));
+		PushPrefix(FPathElement::FromOuter(Outers[Index]));
 	}
 }
 
-FPropertyValidationResult FPropertyValidationContext::MakeValidationResult() const
+FPropertyValidationResult FPropertyValidationContext::MakeValidationResult()
 {
-	FPropertyValidationResult Result;
-	Result.Errors.Reserve(Issues.Num());
-	Result.Warnings.Reserve(Issues.Num());
-	
-	for (const FIssue& Issue: Issues)
+	if (!SoftReferences.IsEmpty())
 	{
-		switch (Issue.Severity)
-		{
-		case EMessageSeverity::Error:
-			Result.Errors.Add(Issue.Message);
-			break;
-		case EMessageSeverity::Warning:
-			Result.Warnings.Add(Issue.Message);
-		default:
-			checkNoEntry();
-		}
+		ResolveSoftReferences();
 	}
-	Result.ValidationResult = Result.Errors.IsEmpty() ? EDataValidationResult::Valid : EDataValidationResult::Invalid;
+
+	FPropertyValidationResult Result;
+	Result.ValidationResult = Issues.Num(EMessageSeverity::Error) == 0 ? EDataValidationResult::Valid : EDataValidationResult::Invalid;
+	// issues are formatted only if result messages are accessed, instead of once per property failure
+	using namespace UE::AssetValidation;
+	const TSharedRef<const FPropertyIssueList> ResultIssues = MakeShared<FPropertyIssueList>(MoveTemp(Issues));
+	Result.Errors = FPropertyMessageList{ResultIssues, EMessageSeverity::Error};
+	Result.Warnings = FPropertyMessageList{ResultIssues, EMessageSeverity::Warning};
+	Issues = {};
+	
 	return Result;
 }
 
 void FPropertyValidationContext::PropertyFails(const FProperty* Property, const FText& DefaultFailureMessage)
 {
-	FProperty* OwnerProperty = Property->GetOwner<FProperty>();
-	const bool bContainerProperty = UE::AssetValidation::IsContainerProperty(OwnerProperty);
+	// issue is formatted only when validation result is reported
+	Issues.Add(EMessageSeverity::Error, Property, DefaultFailureMessage, Prefixes);
+}
+
+void FPropertyValidationContext::CheckSoftReference(const FProperty* Property, const FSoftObjectPath& Path, UE::AssetValidation::ESoftReferenceCheck Check)
+{
+	// issue is confirmed only if reference fails to resolve
+	SoftReferences.Add({Path, Property, Check});
+	SoftReferenceIssues.Add(Issues.AddPending(EMessageSeverity::Error, Property, Prefixes));
+}
 
-	FIssue Issue;
-	Issue.IssueProperty = bContainerProperty ? OwnerProperty : Property;
-	Issue.Severity = EMessageSeverity::Error;
+void FPropertyValidationContext::ResolveSoftReferences()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPropertyValidationContext::ResolveSoftReferences, AssetValidationChannel);
+	using namespace UE::AssetValidation;
 
-	FText PropertyPrefix = FText::GetEmpty();
-	if (!bContainerProperty)
-	{
-		PropertyPrefix = Property->GetDisplayNameText();
-	}
-	
-	if (const FString* CustomMsg = Property->FindMetaData(UE::AssetValidation::FailureMessage); CustomMsg && !CustomMsg->IsEmpty())
+	TArray<ESoftReferenceState> States;
+	UE::AssetValidation::ResolveSoftReferences(SoftReferences, States);
+
+	for (int32 Index = 0; Index < SoftReferences.Num(); ++Index)
 	{
-		Issue.Message = MakeFullMessage(FText::FromString(*CustomMsg), PropertyPrefix);
+		const FSoftObjectPath& Path = SoftReferences[Index].Path;
+		if (States[Index] == ESoftReferenceState::MissingPackage)
+		{
+			Issues.SetFailureMessage(SoftReferenceIssues[Index], FText::Format(LOCTEXT("SoftObjectPath_NotExists", "Soft object path {0}: package {1} doesn't exist on disk."),
+				FText::FromString(Path.ToString()), FText::FromString(Path.GetLongPackageName())));
+		}
+		else if (States[Index] == ESoftReferenceState::MissingObject)
+		{
+			Issues.SetFailureMessage(SoftReferenceIssues[Index], FText::Format(LOCTEXT("SoftObjectPath_ObjectNotExists", "Soft object path {0}: object doesn't exist in package {1}."),
+				FText::FromString(Path.ToString()), FText::FromString(Path.GetLongPackageName())));
+		}
+		else if (States[Index] == ESoftReferenceState::MissingClass)
+		{
+			Issues.SetFailureMessage(SoftReferenceIssues[Index], FText::Format(LOCTEXT("SoftClassPath_NotExists", "Soft class path {0}: class doesn't exist."),
+				FText::FromString(Path.ToString())));
+		}
+		else if (States[Index] == ESoftReferenceState::IncompatibleClass)
+		{
+			Issues.SetFailureMessage(SoftReferenceIssues[Index], FText::Format(LOCTEXT("SoftClassPath_Incompatible", "Soft class path {0}: class doesn't match property MetaClass or AllowedClasses."),
+				FText::FromString(Path.ToString())));
+		}
 	}
-	else
+
+	Issues.RemovePending();
+	SoftReferences.Reset();
+	SoftReferenceIssues.Reset();
+}
+
+void FPropertyValidationContext::ReportMetaDataErrors(TConstArrayView<FString> Errors)
+{
+	for (const FString& Error: Errors)
 	{
-		Issue.Message = MakeFullMessage(DefaultFailureMessage, PropertyPrefix);
+		UE_LOG(LogAssetValidation, Error, TEXT("%s"), *Error);
 	}
-
-	Issues.Add(Issue);
 }
 
 void FPropertyValidationContext::IsPropertyContainerValid(TNonNullPtr<const uint8> ContainerMemory, const UStruct* Struct)
@@ -429,36 +475,4 @@ void FPropertyValidationContext::IsPropertyValueValid(TNonNullPtr<const uint8> P
 	Subsystem->ValidatePropertyValueWithContext(PropertyMemory, Property, MetaData, *this);
 }
 
-FString FPropertyValidationContext::GetBeautifiedName(const UObject* Object) const
-{
-	if (const AActor* Actor = Cast<AActor>(Object))
-	{
-		// display actor label instead of actor name. In editor world it is impossible to find an actor by its name
-		return Actor->GetActorNameOrLabel();
-	}
-
-	return Object->GetName();
-}
-
-FText FPropertyValidationContext::MakeFullMessage(const FText& FailureMessage, const FText& PropertyPrefix) const
-{
-	FString CorrectContext = ContextString;
-	if (PropertyPrefix.IsEmpty())
-	{
-		// remove last dot
-		CorrectContext = CorrectContext.LeftChop(1);
-	}
-	else
-	{
-		// append property prefix
-		CorrectContext += PropertyPrefix.ToString();
-	}
-	
-	FFormatNamedArguments NamedArguments;
-	NamedArguments.Add(TEXT("Context"), FText::FromString(CorrectContext));
-	NamedArguments.Add(TEXT("FailureMessage"), FailureMessage);
-
-	return FText::Format(FTextFormat(LOCTEXT("AssetValidation_Message", "{Context}: {FailureMessage}")), NamedArguments);
-}
-
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
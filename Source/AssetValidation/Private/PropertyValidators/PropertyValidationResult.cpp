@@ -0,0 +1,218 @@
+#include "PropertyValidators/PropertyValidationResult.h"
+
+#include "AssetValidationDefines.h"
+#include "Algo/Compare.h"
+#include "GameFramework/Actor.h"
+#include "PropertyValidators/PropertyValidation.h"
+
+#define LOCTEXT_NAMESPACE "AssetValidation"
+
+namespace UE::AssetValidation
+{
+FPropertyPathElement FPropertyPathElement::FromObject(const UObject* InObject)
+{
+	check(InObject);
+
+	FPropertyPathElement Element;
+	Element.Object = InObject;
+	Element.Type = EType::Object;
+	return Element;
+}
+
+FPropertyPathElement FPropertyPathElement::FromOuter(const UObject* InOuter)
+{
+	check(InOuter);
+
+	FPropertyPathElement Element;
+	Element.Object = InOuter;
+	Element.Type = EType::Outer;
+	return Element;
+}
+
+FString FPropertyPathElement::ToString() const
+{
+	switch (Type)
+	{
+	case EType::Property:
+	{
+		TStringBuilder<128> Builder;
+		Builder << GetPropertyDisplayName(Property);
+		if (Index != INDEX_NONE)
+		{
+			Builder << TEXT("[") << Index << TEXT("]");
+		}
+		if (Suffix != nullptr)
+		{
+			Builder << Suffix;
+		}
+		return FString{Builder.ToView()};
+	}
+	case EType::Object:
+		return ResolveObjectDisplayName(Object);
+	case EType::Outer:
+		if (const AActor* Actor = Cast<AActor>(Object))
+		{
+			// display actor label instead of actor name. In editor world it is impossible to find an actor by its name
+			return Actor->GetActorNameOrLabel();
+		}
+		return Object->GetName();
+	default:
+		return Name;
+	}
+}
+
+bool FPropertyPathElement::operator==(const FPropertyPathElement& Other) const
+{
+	return Type == Other.Type && Property == Other.Property && Object == Other.Object && Index == Other.Index && Suffix == Other.Suffix && Name == Other.Name;
+}
+
+void FPropertyIssueList::Add(EMessageSeverity::Type Severity, const FProperty* Property, const FText& DefaultFailureMessage, TConstArrayView<FPropertyPathElement> Path)
+{
+	SetFailureMessage(AddPending(Severity, Property, Path), DefaultFailureMessage);
+}
+
+int32 FPropertyIssueList::AddPending(EMessageSeverity::Type Severity, const FProperty* Property, TConstArrayView<FPropertyPathElement> Path)
+{
+	check(Property);
+
+	const int32 IssueIndex = Issues.AddDefaulted();
+	FPropertyValidationIssue& Issue = Issues[IssueIndex];
+	Issue.Severity = Severity;
+	// container elements are already described by context path
+	Issue.Property = IsContainerProperty(Property->GetOwner<FProperty>()) ? nullptr : Property;
+	Issue.SourceProperty = Property;
+
+	// share path elements with the previous issue if context path didn't change
+	bool bSharedPath = false;
+	if (IssueIndex > 0)
+	{
+		const FPropertyValidationIssue& PrevIssue = Issues[IssueIndex - 1];
+		if (Algo::Compare(TConstArrayView<FPropertyPathElement>{PathElements.GetData() + PrevIssue.PathIndex, PrevIssue.PathNum}, Path))
+		{
+			Issue.PathIndex = PrevIssue.PathIndex;
+			Issue.PathNum = PrevIssue.PathNum;
+			bSharedPath = true;
+		}
+	}
+	if (!bSharedPath)
+	{
+		Issue.PathIndex = PathElements.Num();
+		Issue.PathNum = Path.Num();
+		PathElements.Append(Path.GetData(), Path.Num());
+	}
+
+	return IssueIndex;
+}
+
+void FPropertyIssueList::SetFailureMessage(int32 IssueIndex, const FText& DefaultFailureMessage)
+{
+	FPropertyValidationIssue& Issue = Issues[IssueIndex];
+	check(Issue.MessageIndex == INDEX_NONE);
+
+	// custom failure message is looked up once per property
+	const int32* CustomMessageIndex = PropertyMessageIndices.Find(Issue.SourceProperty);
+	if (CustomMessageIndex == nullptr)
+	{
+		int32 MessageIndex = INDEX_NONE;
+		if (const FString* CustomMsg = Issue.SourceProperty->FindMetaData(FailureMessage); CustomMsg && !CustomMsg->IsEmpty())
+		{
+			MessageIndex = InternMessage(FText::FromString(*CustomMsg));
+		}
+		CustomMessageIndex = &PropertyMessageIndices.Add(Issue.SourceProperty, MessageIndex);
+	}
+	Issue.MessageIndex = *CustomMessageIndex != INDEX_NONE ? *CustomMessageIndex : InternMessage(DefaultFailureMessage);
+
+	if (Issue.Severity == EMessageSeverity::Error)
+	{
+		++NumErrors;
+	}
+	else if (Issue.Severity == EMessageSeverity::Warning)
+	{
+		++NumWarnings;
+	}
+}
+
+void FPropertyIssueList::RemovePending()
+{
+	// path elements of removed issues are kept, as they may be shared with confirmed issues
+	Issues.RemoveAll([](const FPropertyValidationIssue& Issue) { return Issue.MessageIndex == INDEX_NONE; });
+}
+
+int32 FPropertyIssueList::Num(EMessageSeverity::Type Severity) const
+{
+	switch (Severity)
+	{
+	case EMessageSeverity::Error:
+		return NumErrors;
+	case EMessageSeverity::Warning:
+		return NumWarnings;
+	default:
+		return 0;
+	}
+}
+
+void FPropertyIssueList::Format(EMessageSeverity::Type Severity, TArray<FText>& OutMessages) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FPropertyIssueList::Format, AssetValidationChannel);
+	OutMessages.Reserve(OutMessages.Num() + Num(Severity));
+
+	const FTextFormat MessageFormat{LOCTEXT("AssetValidation_Message", "{Context}: {FailureMessage}")};
+	for (const FPropertyValidationIssue& Issue: Issues)
+	{
+		if (Issue.Severity != Severity || Issue.MessageIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		TStringBuilder<256> Context;
+		for (int32 Index = Issue.PathIndex; Index < Issue.PathIndex + Issue.PathNum; ++Index)
+		{
+			Context << PathElements[Index].ToString() << TEXT(".");
+		}
+
+		if (Issue.Property != nullptr)
+		{
+			// append property prefix
+			Context << Issue.Property->GetDisplayNameText().ToString();
+		}
+		else if (Context.Len() > 0)
+		{
+			// remove last dot
+			Context.RemoveSuffix(1);
+		}
+
+		FFormatNamedArguments NamedArguments;
+		NamedArguments.Add(TEXT("Context"), FText::FromString(FString{Context.ToView()}));
+		NamedArguments.Add(TEXT("FailureMessage"), Messages[Issue.MessageIndex]);
+
+		OutMessages.Add(FText::Format(MessageFormat, NamedArguments));
+	}
+}
+
+void FPropertyMessageList::FormatIssues() const
+{
+	TArray<FText> Formatted;
+	Issues->Format(Severity, Formatted);
+	Formatted.Append(MoveTemp(Messages));
+	
+	Messages = MoveTemp(Formatted);
+	Issues.Reset();
+}
+
+int32 FPropertyIssueList::InternMessage(const FText& Message)
+{
+	const FString& MessageString = Message.ToString();
+	if (const int32* MessageIndex = MessageIndices.Find(MessageString))
+	{
+		return *MessageIndex;
+	}
+
+	const int32 MessageIndex = Messages.Add(Message);
+	MessageIndices.Add(MessageString, MessageIndex);
+
+	return MessageIndex;
+}
+
+} // UE::AssetValidation
+
+#undef LOCTEXT_NAMESPACE
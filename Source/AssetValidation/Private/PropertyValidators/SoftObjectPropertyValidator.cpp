@@ -12,6 +12,14 @@ void USoftObjectPropertyValidator::ValidateProperty(TNonNullPtr<const uint8> Pro
 	const FSoftObjectPtr* SoftObjectPtr = GetPropertyValuePtr<FSoftObjectProperty>(PropertyMemory, Property);
 	check(SoftObjectPtr);
 
-	// @todo: load soft object to verify it?
-	ValidationContext.FailOnCondition(SoftObjectPtr->IsNull(), Property, NSLOCTEXT("AssetValidation", "SoftObjectProperty", "Soft object property not set."));
+	if (SoftObjectPtr->IsNull())
+	{
+		ValidationContext.PropertyFails(Property, NSLOCTEXT("AssetValidation", "SoftObjectProperty", "Soft object property not set."));
+	}
+	else if (SoftObjectPtr->Get() == nullptr)
+	{
+		// verify that referenced object exists without loading it, resolved together with other soft references at the end of validation pass
+		const UE::AssetValidation::ESoftReferenceCheck Check = Property->IsA<FSoftClassProperty>() ? UE::AssetValidation::ESoftReferenceCheck::Class : UE::AssetValidation::ESoftReferenceCheck::Object;
+		ValidationContext.CheckSoftReference(Property, SoftObjectPtr->ToSoftObjectPath(), Check);
+	}
 }
@@ -0,0 +1,352 @@
+#include "PropertyValidators/SoftReferenceResolver.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+#include "PropertyValidators/PropertyValidation.h"
+#include "UObject/Package.h"
+
+namespace UE::AssetValidation
+{
+/** Where referenced package was found */
+enum class EPackageState: uint8
+{
+	/** package is known to asset registry or loaded in memory, its objects can be looked up without loading */
+	Registered,
+	/** package was found only on disk */
+	OnDisk,
+	Missing
+};
+
+static EPackageState FindPackageState(const IAssetRegistry& AssetRegistry, FName PackageName)
+{
+	if (AssetRegistry.GetAssetPackageDataCopy(PackageName).IsSet())
+	{
+		return EPackageState::Registered;
+	}
+
+	// script packages and packages that were created but not saved yet are found only in memory
+	const FString PackageNameString = PackageName.ToString();
+	if (FindObject<UPackage>(nullptr, *PackageNameString) != nullptr)
+	{
+		return EPackageState::Registered;
+	}
+
+	// asset registry may still be discovering assets, or package is mounted outside of scanned paths
+	return FPackageName::DoesPackageExist(PackageNameString) ? EPackageState::OnDisk : EPackageState::Missing;
+}
+
+/**
+ * @return asset data of a blueprint that generates @ClassPath, invalid if class is not generated by a registered blueprint
+ * Blueprint generated classes are not registered as assets, so blueprint is found by its name and matched by generated class tag
+ */
+static FAssetData FindGeneratingBlueprint(const IAssetRegistry& AssetRegistry, const FTopLevelAssetPath& ClassPath)
+{
+	TStringBuilder<NAME_SIZE> ClassName;
+	ClassPath.GetAssetName().ToString(ClassName);
+
+	FStringView BlueprintName = ClassName.ToView();
+	if (!BlueprintName.EndsWith(TEXT("_C")))
+	{
+		return FAssetData{};
+	}
+
+	BlueprintName.LeftChopInline(2);
+	if (BlueprintName.StartsWith(TEXT("SKEL_")))
+	{
+		BlueprintName.RightChopInline(5);
+	}
+
+	FAssetData Blueprint = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath{ClassPath.GetPackageName(), FName{BlueprintName}, {}}, false, false);
+	if (Blueprint.IsValid())
+	{
+		FString GeneratedClassPath;
+		if (Blueprint.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath) &&
+			FTopLevelAssetPath{FPackageName::ExportTextPathToObjectPathView(GeneratedClassPath)} != ClassPath)
+		{
+			// asset with a matching name doesn't generate this class
+			return FAssetData{};
+		}
+	}
+
+	return Blueprint;
+}
+
+/** @return class path stored in a blueprint asset tag, empty if tag is not set */
+static FTopLevelAssetPath GetClassPathTag(const FAssetData& Blueprint, FName Tag)
+{
+	FString ExportPath;
+	if (Blueprint.GetTagValue(Tag, ExportPath) && !ExportPath.IsEmpty())
+	{
+		return FTopLevelAssetPath{FPackageName::ExportTextPathToObjectPath(ExportPath)};
+	}
+
+	return FTopLevelAssetPath{};
+}
+
+/** @return class from native class table or a loaded blueprint class, without loading it */
+static const UClass* FindLoadedClass(const FTopLevelAssetPath& ClassPath)
+{
+	return ClassPath.IsValid() ? FindObject<UClass>(ClassPath) : nullptr;
+}
+
+static bool DoesObjectExist(const IAssetRegistry& AssetRegistry, const FSoftObjectPath& AssetPath)
+{
+	// asset registry looks up objects loaded in memory first, then on disk assets
+	if (AssetRegistry.GetAssetByObjectPath(AssetPath, false, false).IsValid())
+	{
+		return true;
+	}
+
+	if (FindGeneratingBlueprint(AssetRegistry, AssetPath.GetAssetPath()).IsValid())
+	{
+		return true;
+	}
+
+	// native objects and objects that are not assets, but are loaded in memory
+	return AssetPath.ResolveObject() != nullptr;
+}
+
+/** Class hierarchy gathered without loading a class */
+struct FClassInfo
+{
+	/** paths of unloaded blueprint classes, starting from the class itself and up to the first loaded super class */
+	TArray<FTopLevelAssetPath, TInlineAllocator<4>> BlueprintHierarchy;
+	/** first class of a hierarchy that is loaded in memory, always set for native classes */
+	const UClass* LoadedClass = nullptr;
+	/** native parent class from a blueprint tag, used if blueprint hierarchy is broken */
+	const UClass* NativeParentClass = nullptr;
+	bool bExists = false;
+};
+
+static FClassInfo FindClassInfo(const IAssetRegistry& AssetRegistry, const FTopLevelAssetPath& ClassPath)
+{
+	FClassInfo ClassInfo;
+
+	FTopLevelAssetPath CurrentPath = ClassPath;
+	while (CurrentPath.IsValid())
+	{
+		// native class table, also contains blueprint classes that are already loaded
+		if (const UClass* Class = FindLoadedClass(CurrentPath))
+		{
+			ClassInfo.LoadedClass = Class;
+			ClassInfo.bExists = true;
+			break;
+		}
+
+		const FAssetData Blueprint = FindGeneratingBlueprint(AssetRegistry, CurrentPath);
+		if (!Blueprint.IsValid() || ClassInfo.BlueprintHierarchy.Contains(CurrentPath))
+		{
+			// super class is missing, class itself exists but its hierarchy is unknown past this point
+			break;
+		}
+
+		if (ClassInfo.BlueprintHierarchy.IsEmpty())
+		{
+			ClassInfo.bExists = true;
+			ClassInfo.NativeParentClass = FindLoadedClass(GetClassPathTag(Blueprint, FBlueprintTags::NativeParentClassPath));
+		}
+
+		ClassInfo.BlueprintHierarchy.Add(CurrentPath);
+		CurrentPath = GetClassPathTag(Blueprint, FBlueprintTags::ParentClassPath);
+	}
+
+	return ClassInfo;
+}
+
+/** Class a reference is allowed to point to, blueprint classes may be known only by path */
+struct FAllowedClass
+{
+	FTopLevelAssetPath Path;
+	const UClass* Class = nullptr;
+	/** referenced class should always be a child of a meta class, and a child of any of allowed classes */
+	bool bMetaClass = false;
+};
+
+/** Gather classes from MetaClass and AllowedClasses meta data of a property, or from soft class property meta class */
+static void GetAllowedClasses(const FProperty* Property, TArray<FAllowedClass>& OutClasses)
+{
+	static const FName NAME_MetaClass{TEXT("MetaClass")};
+	static const FName NAME_AllowedClasses{TEXT("AllowedClasses")};
+
+	if (const FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(Property); SoftClassProperty && SoftClassProperty->MetaClass)
+	{
+		OutClasses.Add({SoftClassProperty->MetaClass->GetClassPathName(), SoftClassProperty->MetaClass, true});
+	}
+
+	// meta data of container elements is stored on container property
+	if (const FProperty* OwnerProperty = Property->GetOwner<FProperty>(); IsContainerProperty(OwnerProperty))
+	{
+		Property = OwnerProperty;
+	}
+
+	auto AddClass = [&OutClasses](FString ClassName, bool bMetaClass)
+	{
+		ClassName.TrimStartAndEndInline();
+		if (ClassName.IsEmpty())
+		{
+			return;
+		}
+
+		if (FPackageName::IsValidObjectPath(ClassName))
+		{
+			const FTopLevelAssetPath ClassPath{ClassName};
+			OutClasses.Add({ClassPath, FindLoadedClass(ClassPath), bMetaClass});
+		}
+		else if (const UClass* Class = UClass::TryFindTypeSlow<UClass>(ClassName))
+		{
+			OutClasses.Add({Class->GetClassPathName(), Class, bMetaClass});
+		}
+	};
+
+	if (const FString* MetaClass = Property->FindMetaData(NAME_MetaClass))
+	{
+		AddClass(*MetaClass, true);
+	}
+	if (const FString* AllowedClasses = Property->FindMetaData(NAME_AllowedClasses))
+	{
+		TArray<FString> ClassNames;
+		AllowedClasses->ParseIntoArray(ClassNames, TEXT(","));
+		for (const FString& ClassName: ClassNames)
+		{
+			AddClass(ClassName, false);
+		}
+	}
+}
+
+/** @return whether class described by @ClassInfo is a child of @AllowedClass. Unknown parts of class hierarchy are not treated as failure */
+static bool IsChildOf(const FClassInfo& ClassInfo, const FAllowedClass& AllowedClass)
+{
+	if (ClassInfo.BlueprintHierarchy.Contains(AllowedClass.Path))
+	{
+		return true;
+	}
+
+	if (AllowedClass.Class != nullptr && AllowedClass.Class->HasAnyClassFlags(CLASS_Interface))
+	{
+		// interfaces implemented by unloaded blueprint classes are unknown
+		return !ClassInfo.BlueprintHierarchy.IsEmpty() || ClassInfo.LoadedClass == nullptr || ClassInfo.LoadedClass->ImplementsInterface(AllowedClass.Class);
+	}
+
+	if (AllowedClass.Class == nullptr)
+	{
+		// allowed blueprint class is not loaded, so it can't be a super class of a loaded class
+		return ClassInfo.LoadedClass == nullptr;
+	}
+
+	if (ClassInfo.LoadedClass != nullptr)
+	{
+		return ClassInfo.LoadedClass->IsChildOf(AllowedClass.Class);
+	}
+
+	// blueprint hierarchy is broken, only native allowed classes can be checked against native parent class
+	if (ClassInfo.NativeParentClass == nullptr || !AllowedClass.Class->IsNative())
+	{
+		return true;
+	}
+	return ClassInfo.NativeParentClass->IsChildOf(AllowedClass.Class);
+}
+
+void ResolveSoftReferences(TConstArrayView<FSoftReferenceQuery> Queries, TArray<ESoftReferenceState>& OutStates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(ResolveSoftReferences, AssetValidationChannel);
+
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	// missing asset registry entries are not conclusive until initial asset search completes
+	const bool bRegistryComplete = !AssetRegistry.IsLoadingAssets();
+
+	TMap<FName, EPackageState> Packages;
+	TMap<FSoftObjectPath, bool> Objects;
+	TMap<FTopLevelAssetPath, FClassInfo> Classes;
+	TMap<const FProperty*, TArray<FAllowedClass>> PropertyAllowedClasses;
+
+	auto GetPackageState = [&AssetRegistry, &Packages](FName PackageName)
+	{
+		if (const EPackageState* PackageState = Packages.Find(PackageName))
+		{
+			return *PackageState;
+		}
+		return Packages.Add(PackageName, FindPackageState(AssetRegistry, PackageName));
+	};
+
+	OutStates.SetNumUninitialized(Queries.Num());
+	for (int32 Index = 0; Index < Queries.Num(); ++Index)
+	{
+		const FSoftReferenceQuery& Query = Queries[Index];
+		ESoftReferenceState State = ESoftReferenceState::Exists;
+
+		if (Query.Check == ESoftReferenceCheck::Class)
+		{
+			const FTopLevelAssetPath ClassPath = Query.Path.GetAssetPath();
+			const FClassInfo* ClassInfo = Classes.Find(ClassPath);
+			if (ClassInfo == nullptr)
+			{
+				ClassInfo = &Classes.Add(ClassPath, FindClassInfo(AssetRegistry, ClassPath));
+			}
+
+			if (!ClassInfo->bExists)
+			{
+				// blueprint may be not discovered yet, fall back to package existence
+				const bool bPackageExists = !bRegistryComplete && GetPackageState(ClassPath.GetPackageName()) != EPackageState::Missing;
+				State = bPackageExists ? ESoftReferenceState::Exists : ESoftReferenceState::MissingClass;
+			}
+			else
+			{
+				check(Query.Property);
+
+				const TArray<FAllowedClass>* AllowedClasses = PropertyAllowedClasses.Find(Query.Property);
+				if (AllowedClasses == nullptr)
+				{
+					TArray<FAllowedClass>& NewAllowedClasses = PropertyAllowedClasses.Add(Query.Property);
+					GetAllowedClasses(Query.Property, NewAllowedClasses);
+					AllowedClasses = &NewAllowedClasses;
+				}
+
+				bool bHasAllowedClasses = false, bAllowed = false, bMetaClassMatches = true;
+				for (const FAllowedClass& AllowedClass: *AllowedClasses)
+				{
+					if (AllowedClass.bMetaClass)
+					{
+						bMetaClassMatches &= IsChildOf(*ClassInfo, AllowedClass);
+					}
+					else
+					{
+						bHasAllowedClasses = true;
+						bAllowed = bAllowed || IsChildOf(*ClassInfo, AllowedClass);
+					}
+				}
+
+				if (!bMetaClassMatches || (bHasAllowedClasses && !bAllowed))
+				{
+					State = ESoftReferenceState::IncompatibleClass;
+				}
+			}
+
+			OutStates[Index] = State;
+			continue;
+		}
+
+		const EPackageState PackageState = GetPackageState(Query.Path.GetLongPackageFName());
+		if (PackageState == EPackageState::Missing)
+		{
+			State = ESoftReferenceState::MissingPackage;
+		}
+		else if (Query.Check == ESoftReferenceCheck::Object && bRegistryComplete && PackageState == EPackageState::Registered)
+		{
+			// sub objects are not registered, check their owning asset instead
+			const FSoftObjectPath AssetPath = Query.Path.GetWithoutSubPath();
+			const bool* bObjectExists = Objects.Find(AssetPath);
+			if (bObjectExists == nullptr)
+			{
+				bObjectExists = &Objects.Add(AssetPath, DoesObjectExist(AssetRegistry, AssetPath));
+			}
+
+			State = *bObjectExists ? ESoftReferenceState::Exists : ESoftReferenceState::MissingObject;
+		}
+
+		OutStates[Index] = State;
+	}
+}
+
+} // UE::AssetValidation
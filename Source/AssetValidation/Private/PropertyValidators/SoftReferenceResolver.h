@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE::AssetValidation
+{
+	struct FSoftReferenceQuery;
+
+	/** Existence state of a soft reference */
+	enum class ESoftReferenceState: uint8
+	{
+		Exists,
+		/** referenced package is not known to asset registry, not loaded and doesn't exist on disk */
+		MissingPackage,
+		/** referenced package exists, but referenced object is not found in it */
+		MissingObject,
+		/** referenced class is neither a native class nor a class generated by a registered blueprint */
+		MissingClass,
+		/** referenced class is not a child of property MetaClass or any of its AllowedClasses */
+		IncompatibleClass
+	};
+
+	/**
+	 * Resolve soft references queued during property validation pass in a single batch
+	 * References are deduplicated by package and object path and resolved against in-memory asset registry state and loaded objects.
+	 * File system is queried only for packages unknown to asset registry, so that valid references never hit the disk.
+	 * Class hierarchy of unloaded blueprint classes is restored from blueprint asset tags, so classes are never loaded
+	 * @param Queries soft references to resolve
+	 * @param OutStates existence state for each query
+	 */
+	void ResolveSoftReferences(TConstArrayView<FSoftReferenceQuery> Queries, TArray<ESoftReferenceState>& OutStates);
+}
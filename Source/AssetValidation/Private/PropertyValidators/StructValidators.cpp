@@ -31,12 +31,8 @@ void UStructValidator_SoftObjectPath::ValidateProperty(TNonNullPtr<const uint8>
 	}
 	else if (ObjectPath->IsAsset())
 	{
-		if (const FString PackageName = ObjectPath->GetLongPackageName(); !FPackageName::DoesPackageExist(PackageName))
-		{
-			const FText FailReason = FText::Format(LOCTEXT("SoftObjectPath_NotExists", "Soft object path {0}: package {1} doesn't exist on disk."),
-				FText::FromString(ObjectPath->ToString()), FText::FromString(PackageName));
-			ValidationContext.PropertyFails(Property, FailReason);
-		}
+		// existence is resolved together with other soft references at the end of validation pass
+		ValidationContext.CheckSoftReference(Property, *ObjectPath, UE::AssetValidation::ESoftReferenceCheck::Package);
 	}
 }
 
@@ -55,12 +51,11 @@ void UStructValidator_SoftClassPath::ValidateProperty(TNonNullPtr<const uint8> P
 	{
 		ValidationContext.PropertyFails(Property, LOCTEXT("SoftClassPath_Null", "Soft class path not set."));
 	}
-	// same as FSoftClassPath::TryLoadClass<T> but with LOAD_Quiet to silence the warning
-	else if (UObject*	Class = LoadClass<UObject>(nullptr, *ClassPath->ToString(), nullptr, LOAD_Quiet);
-						Class == nullptr)
+	else
 	{
-		const FText FailReason = FText::Format(LOCTEXT("SoftClassPath_NotExists", "Soft class path {0}: failed to load class."), FText::FromString(ClassPath->ToString()));
-		ValidationContext.PropertyFails(Property, FailReason);
+		// class is resolved from asset registry tags and native class table without loading it,
+		// together with other soft references at the end of validation pass
+		ValidationContext.CheckSoftReference(Property, *ClassPath, UE::AssetValidation::ESoftReferenceCheck::Class);
 	}
 }
 
@@ -313,16 +308,9 @@ void UContainerValidator_InstancedStruct::ValidateStructAsContainer(TNonNullPtr<
 		TSharedPtr<FStructProperty> InnerProperty{CastFieldChecked<FStructProperty>(FStructProperty::StaticClass()->Construct(StructProperty->GetOwnerUObject(), FName{PropertyName}, RF_NoFlags))};
 		InnerProperty->Struct = ScriptStruct;
 
-		// Ad hoc Validate meta so that struct value is validated as well. Don't rely it being present in MetaData, as it can be Container->InstancedStruct->Struct case. // @todo: make it pretty
-		const bool bHasMetaData = MetaData.HasMetaData(UE::AssetValidation::Validate);
-		MetaData.SetMetaData(UE::AssetValidation::Validate);
-		
-		ValidationContext.IsPropertyValueValid(InstancedStruct->GetMemory(), InnerProperty.Get(), MetaData);
-
-		if (bHasMetaData == false)
-		{
-			MetaData.RemoveMetaData(UE::AssetValidation::Validate);
-		}
+		// Ad hoc Validate meta so that struct value is validated as well. Don't rely it being present in MetaData, as it can be Container->InstancedStruct->Struct case
+		FMetaDataSource ValueMetaData = MetaData.WithImpliedMetaData(UE::AssetValidation::Validate);
+		ValidationContext.IsPropertyValueValid(InstancedStruct->GetMemory(), InnerProperty.Get(), ValueMetaData);
 	}
 }
 
@@ -0,0 +1,103 @@
+#include "AssetDependencyTree.h"
+
+#include "AutomationHelpers.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/AutomationTest.h"
+
+using UE::AssetValidation::AutomationFlags;
+
+/**
+ * Dependency tree with a graph built by hand. Nodes are marked as resolved, so audit never queries asset registry or loads assets
+ */
+class FTestAssetDependencyTree: public FAssetDependencyTree
+{
+public:
+	static FAssetData MakeAssetData(const TCHAR* AssetName)
+	{
+		const FString PackageName = FString::Printf(TEXT("/AssetValidation/DependencyTreeTest/%s"), AssetName);
+		return FAssetData{FName{PackageName}, FName{TEXT("/AssetValidation/DependencyTreeTest")}, FName{AssetName}, UObject::StaticClass()->GetClassPathName()};
+	}
+
+	void AddNode(const TCHAR* AssetName, float DiskSizeBytes, float MemorySizeBytes)
+	{
+		FAssetNode& Node = Nodes[FindOrAddNode(MakeAssetData(AssetName))];
+		Node.DiskSizeBytes = DiskSizeBytes;
+		Node.MemorySizeBytes = MemorySizeBytes;
+		Node.bSizeValid = true;
+		Node.bDependenciesValid = true;
+	}
+
+	void AddDependency(const TCHAR* Referencer, const TCHAR* Dependency)
+	{
+		const FNodeIndex ReferencerIndex = FindOrAddNode(MakeAssetData(Referencer));
+		const FNodeIndex DependencyIndex = FindOrAddNode(MakeAssetData(Dependency));
+		Nodes[ReferencerIndex].Dependencies.AddUnique(DependencyIndex);
+		Nodes[DependencyIndex].Referencers.AddUnique(ReferencerIndex);
+	}
+
+	bool Audit(const TCHAR* AssetName, FAssetAuditResult& OutResult)
+	{
+		return AuditAsset(IAssetRegistry::GetChecked(), MakeAssetData(AssetName), OutResult);
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAutomationTest_DependencyTreeCondensation, "AssetValidation.DependencyTree.Condensation", AutomationFlags)
+
+bool FAutomationTest_DependencyTreeCondensation::RunTest(const FString& Parameters)
+{
+	// A depends on B and C, which share D. D and E depend on each other
+	FTestAssetDependencyTree Tree;
+	Tree.AddNode(TEXT("A"), 1.f, 10.f);
+	Tree.AddNode(TEXT("B"), 2.f, 20.f);
+	Tree.AddNode(TEXT("C"), 4.f, 40.f);
+	Tree.AddNode(TEXT("D"), 8.f, 80.f);
+	Tree.AddNode(TEXT("E"), 16.f, 160.f);
+	Tree.AddDependency(TEXT("A"), TEXT("B"));
+	Tree.AddDependency(TEXT("A"), TEXT("C"));
+	Tree.AddDependency(TEXT("B"), TEXT("D"));
+	Tree.AddDependency(TEXT("C"), TEXT("D"));
+	Tree.AddDependency(TEXT("D"), TEXT("E"));
+	Tree.AddDependency(TEXT("E"), TEXT("D"));
+
+	{
+		FAssetAuditResult Result;
+		UTEST_TRUE(TEXT("Audit A"), Tree.Audit(TEXT("A"), Result));
+		// shared dependency D and circular dependency E are counted once
+		UTEST_EQUAL(TEXT("TotalDiskSize"), Result.TotalDiskSizeBytes, 31.f);
+		UTEST_EQUAL(TEXT("TotalMemorySize"), Result.TotalMemorySizeBytes, 310.f);
+		UTEST_EQUAL(TEXT("TotalDependencyCount"), Result.TotalDependencyCount, 4);
+		// D and E are counted once for each path through B and C
+		UTEST_EQUAL(TEXT("InclusiveDiskSize"), Result.InclusiveDiskSizeBytes, 55.f);
+		UTEST_EQUAL(TEXT("InclusiveMemorySize"), Result.InclusiveMemorySizeBytes, 550.f);
+		// circular dependency is a single level
+		UTEST_EQUAL(TEXT("DependencyDepth"), Result.DependencyDepth, 3);
+		UTEST_EQUAL(TEXT("MaxDependencyBreadth"), Result.MaxDependencyBreadth, 2);
+	}
+
+	{
+		FAssetAuditResult Result;
+		UTEST_TRUE(TEXT("Audit D"), Tree.Audit(TEXT("D"), Result));
+		// nodes of a circular dependency share sizes and depth
+		UTEST_EQUAL(TEXT("TotalDiskSize"), Result.TotalDiskSizeBytes, 24.f);
+		UTEST_EQUAL(TEXT("InclusiveDiskSize"), Result.InclusiveDiskSizeBytes, 24.f);
+		UTEST_EQUAL(TEXT("TotalDependencyCount"), Result.TotalDependencyCount, 1);
+		UTEST_EQUAL(TEXT("DependencyDepth"), Result.DependencyDepth, 1);
+
+		FAssetAuditResult CircularResult;
+		UTEST_TRUE(TEXT("Audit E"), Tree.Audit(TEXT("E"), CircularResult));
+		UTEST_EQUAL(TEXT("TotalDiskSize"), CircularResult.TotalDiskSizeBytes, Result.TotalDiskSizeBytes);
+		UTEST_EQUAL(TEXT("DependencyDepth"), CircularResult.DependencyDepth, Result.DependencyDepth);
+	}
+
+	{
+		// B is audited after A, so its aggregate data is memoized
+		FAssetAuditResult Result;
+		UTEST_TRUE(TEXT("Audit B"), Tree.Audit(TEXT("B"), Result));
+		UTEST_EQUAL(TEXT("TotalDiskSize"), Result.TotalDiskSizeBytes, 26.f);
+		UTEST_EQUAL(TEXT("InclusiveDiskSize"), Result.InclusiveDiskSizeBytes, 26.f);
+		UTEST_EQUAL(TEXT("TotalDependencyCount"), Result.TotalDependencyCount, 2);
+		UTEST_EQUAL(TEXT("DependencyDepth"), Result.DependencyDepth, 2);
+	}
+
+	return true;
+}
@@ -0,0 +1,129 @@
+#include "Commandlet/AssetValidationCommandlet.h"
+
+#include "AutomationHelpers.h"
+#include "Algo/Reverse.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/AutomationTest.h"
+
+using UE::AssetValidation::AutomationFlags;
+
+namespace UE::AssetValidation::ShardTests
+{
+	static FAssetData MakeAssetData(const FString& PackagePath, const FString& AssetName)
+	{
+		return FAssetData{FName{PackagePath / AssetName}, FName{PackagePath}, FName{AssetName}, UObject::StaticClass()->GetClassPathName()};
+	}
+
+	static TArray<FAssetData> MakeAssets(int32 NumAssets)
+	{
+		TArray<FAssetData> Assets;
+		for (int32 Index = 0; Index < NumAssets; ++Index)
+		{
+			Assets.Add(MakeAssetData(TEXT("/Game/ShardTest"), FString::Printf(TEXT("Asset_%d"), Index)));
+		}
+		return Assets;
+	}
+
+	static TArray<FName> GetPackageNames(TConstArrayView<FAssetData> Assets)
+	{
+		TArray<FName> PackageNames;
+		for (const FAssetData& AssetData: Assets)
+		{
+			PackageNames.Add(AssetData.PackageName);
+		}
+		PackageNames.Sort(FNameLexicalLess{});
+		return PackageNames;
+	}
+}
+
+BEGIN_DEFINE_SPEC(FAutomationSpec_CommandletShards, "AssetValidation.Commandlet.Shards", AutomationFlags)
+END_DEFINE_SPEC(FAutomationSpec_CommandletShards)
+
+void FAutomationSpec_CommandletShards::Define()
+{
+	using namespace UE::AssetValidation::ShardTests;
+	
+	Describe("ParseShard", [this]
+	{
+		It("Should parse zero based shard index and shard count", [this]
+		{
+			int32 ShardIndex = INDEX_NONE, NumShards = INDEX_NONE;
+			TestTrue(TEXT("3/16"), UAssetValidationCommandlet::ParseShard(TEXT("3/16"), ShardIndex, NumShards));
+			TestEqual(TEXT("ShardIndex"), ShardIndex, 3);
+			TestEqual(TEXT("NumShards"), NumShards, 16);
+
+			TestTrue(TEXT("0/1"), UAssetValidationCommandlet::ParseShard(TEXT("0/1"), ShardIndex, NumShards));
+		});
+
+		It("Should reject malformed and out of range values", [this]
+		{
+			int32 ShardIndex = INDEX_NONE, NumShards = INDEX_NONE;
+			for (const TCHAR* Value: {TEXT(""), TEXT("3"), TEXT("/16"), TEXT("3/"), TEXT("16/16"), TEXT("1/0"), TEXT("-1/4"), TEXT("+1/4"),
+									  TEXT("1.5/4"), TEXT("a/4"), TEXT("1/4/8"), TEXT("1/9999999999")})
+			{
+				TestFalse(Value, UAssetValidationCommandlet::ParseShard(Value, ShardIndex, NumShards));
+			}
+		});
+	});
+
+	Describe("FilterShardAssets", [this]
+	{
+		It("Should assign each asset to exactly one shard", [this]
+		{
+			constexpr int32 NumShards = 4;
+			const TArray<FAssetData> Assets = MakeAssets(64);
+
+			TArray<FName> ShardedPackages;
+			for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+			{
+				TArray<FAssetData> ShardAssets = Assets;
+				UAssetValidationCommandlet::FilterShardAssets(ShardAssets, ShardIndex, NumShards);
+				ShardedPackages.Append(GetPackageNames(ShardAssets));
+			}
+
+			ShardedPackages.Sort(FNameLexicalLess{});
+			TestEqual(TEXT("Shards cover all assets once"), ShardedPackages, GetPackageNames(Assets));
+		});
+
+		It("Should not depend on asset order", [this]
+		{
+			constexpr int32 NumShards = 3;
+			TArray<FAssetData> Assets = MakeAssets(32);
+			TArray<FAssetData> ReversedAssets = Assets;
+			Algo::Reverse(ReversedAssets);
+
+			for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+			{
+				TArray<FAssetData> ShardAssets = Assets;
+				UAssetValidationCommandlet::FilterShardAssets(ShardAssets, ShardIndex, NumShards);
+				TArray<FAssetData> ReversedShardAssets = ReversedAssets;
+				UAssetValidationCommandlet::FilterShardAssets(ReversedShardAssets, ShardIndex, NumShards);
+
+				TestEqual(TEXT("Shard assets"), GetPackageNames(ShardAssets), GetPackageNames(ReversedShardAssets));
+			}
+		});
+
+		It("Should keep external actors in the same shard as their world", [this]
+		{
+			const FAssetData World = MakeAssetData(TEXT("/Game/ShardTest/Maps"), TEXT("World"));
+			TArray<FAssetData> Assets{World};
+			for (int32 Index = 0; Index < 16; ++Index)
+			{
+				FAssetData ExternalActor = MakeAssetData(TEXT("/Game/__ExternalActors__/ShardTest/Maps/World"), FString::Printf(TEXT("Actor_%d"), Index));
+				ExternalActor.OptionalOuterPath = FName{TEXT("/Game/ShardTest/Maps/World.World:PersistentLevel")};
+				Assets.Add(ExternalActor);
+			}
+
+			for (int32 NumShards = 2; NumShards <= 8; ++NumShards)
+			{
+				for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+				{
+					TArray<FAssetData> ShardAssets = Assets;
+					UAssetValidationCommandlet::FilterShardAssets(ShardAssets, ShardIndex, NumShards);
+					// shard contains either the world with all of its external actors, or none of them
+					TestTrue(TEXT("World is not split"), ShardAssets.IsEmpty() || ShardAssets.Num() == Assets.Num());
+				}
+			}
+		});
+	});
+}
@@ -1,6 +1,8 @@
 ﻿#include "EditConditionTests.h"
 
 #include "AutomationHelpers.h"
+#include "EditCondition/EditConditionCache.h"
+#include "EditCondition/EditConditionContext.h"
 #include "PropertyValidators/PropertyValidation.h"
 
 using UE::AssetValidation::AutomationFlags;
@@ -73,6 +75,16 @@ void FAutomationSpec_EditConditionValue::Define()
 				});
 			}
 
+			{
+				FString Desc = FString::Printf(TEXT("Cached Condition Value: %s"), *PropertyName.ToString());
+				It(Desc, [this, PropertyName, ExpectedResult]
+				{
+					// second evaluation uses compiled expression from edit condition cache
+					TestEditCondition(TestObject, PropertyName, ExpectedResult);
+					TestEditCondition(TestObject, PropertyName, ExpectedResult);
+				});
+			}
+
 			{
 				FString Desc = FString::Printf(TEXT("Validation Result: %s"), *PropertyName.ToString());
 				It(Desc, [this, PropertyName, ExpectedResult]
@@ -90,6 +102,105 @@ void FAutomationSpec_EditConditionValue::Define()
 		TestEqual("NumErrors", Result.Errors.Num(), 5);
 	});
 	
+	Describe("Edit Condition Cache", [this]
+	{
+		using namespace UE::AssetValidation;
+		
+		It("Should return cached expression", [this]
+		{
+			UClass* Class = TestObject->GetClass();
+			FProperty* Property = Class->FindPropertyByName("ComplexConditionTrue");
+			
+			TSharedPtr<const FEditConditionExpression> Expression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+			TestTrue("Expression is compiled", Expression.IsValid());
+			TestTrue("Expression is cached", Expression == FEditConditionCache::Get().FindOrCompile(Class, Property));
+		});
+
+		It("Should compile expression for each struct", [this]
+		{
+			UObject* DerivedObject = NewObject<UValidationTestObject_EditConditionDerived>(GetTransientPackage());
+			UClass* Class = TestObject->GetClass();
+			UClass* DerivedClass = DerivedObject->GetClass();
+			FProperty* Property = Class->FindPropertyByName("IntConditionFalse");
+			
+			TSharedPtr<const FEditConditionExpression> Expression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+			TSharedPtr<const FEditConditionExpression> DerivedExpression = FEditConditionCache::Get().FindOrCompile(DerivedClass, Property);
+			if (!TestTrue("Expressions are compiled", Expression.IsValid() && DerivedExpression.IsValid()))
+			{
+				return;
+			}
+			
+			TestTrue("Structs don't share cache entry", Expression != DerivedExpression);
+			TestTrue("Derived struct expression is cached", DerivedExpression == FEditConditionCache::Get().FindOrCompile(DerivedClass, Property));
+
+			// cached expressions are evaluated against their own struct values
+			TestEditCondition(TestObject, Property->GetFName(), false);
+			TestEditCondition(DerivedObject, Property->GetFName(), true);
+		});
+
+		It("Should resolve property tokens", [this]
+		{
+			UClass* Class = TestObject->GetClass();
+			FProperty* Property = Class->FindPropertyByName("ComplexConditionTrue");
+			
+			TSharedPtr<const FEditConditionExpression> Expression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+			if (!TestTrue("Expression is compiled", Expression.IsValid()))
+			{
+				return;
+			}
+
+			int32 NumPropertyTokens = 0;
+			for (const FCompiledToken& Token: Expression->Tokens)
+			{
+				if (const FPropertyToken* PropertyToken = Token.Node.Cast<FPropertyToken>())
+				{
+					++NumPropertyTokens;
+					TestTrue(FString::Printf(TEXT("Property token %s is resolved"), *PropertyToken->PropertyName.ToString()),
+						PropertyToken->Property != nullptr && PropertyToken->Property == Class->FindPropertyByName(PropertyToken->PropertyName));
+				}
+			}
+			TestEqual("NumPropertyTokens", NumPropertyTokens, 4);
+		});
+
+		It("Should resolve enum tokens", [this]
+		{
+			UClass* Class = TestObject->GetClass();
+			FProperty* Property = Class->FindPropertyByName("EnumConditionTrue");
+			
+			TSharedPtr<const FEditConditionExpression> Expression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+			if (!TestTrue("Expression is compiled", Expression.IsValid()))
+			{
+				return;
+			}
+
+			int32 NumEnumTokens = 0;
+			for (const FCompiledToken& Token: Expression->Tokens)
+			{
+				if (const FEnumToken* EnumToken = Token.Node.Cast<FEnumToken>())
+				{
+					++NumEnumTokens;
+					TestTrue("Enum type is resolved", EnumToken->Enum == StaticEnum<ESimpleEnum>());
+					TestEqual("Enum value is resolved", EnumToken->EnumValue, static_cast<int64>(ESimpleEnum::None));
+				}
+			}
+			TestEqual("NumEnumTokens", NumEnumTokens, 1);
+		});
+
+		It("Should compile expression again after invalidation", [this]
+		{
+			UClass* Class = TestObject->GetClass();
+			FProperty* Property = Class->FindPropertyByName("BoolConditionTrue");
+			
+			TSharedPtr<const FEditConditionExpression> Expression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+			FEditConditionCache::Get().Invalidate();
+			TSharedPtr<const FEditConditionExpression> NewExpression = FEditConditionCache::Get().FindOrCompile(Class, Property);
+
+			TestTrue("Expressions are compiled", Expression.IsValid() && NewExpression.IsValid());
+			TestTrue("Expression is compiled again", Expression != NewExpression);
+			TestEditCondition(TestObject, Property->GetFName(), true);
+		});
+	});
+	
 	AfterEach([this]
 	{
 		Subsystem	= nullptr;
@@ -53,3 +53,14 @@ public:
 	UPROPERTY(EditAnywhere, meta = (EditCondition = "Pointer == nullptr || Bool == false || (Int == 32 && Enum == ESimpleEnum::Two)", Validate))
 	UObject* ComplexConditionTrue = nullptr;
 };
+
+UCLASS(HideDropdown)
+class UValidationTestObject_EditConditionDerived: public UValidationTestObject_EditCondition
+{
+	GENERATED_BODY()
+public:
+	UValidationTestObject_EditConditionDerived()
+	{
+		Int = 8;
+	}
+};
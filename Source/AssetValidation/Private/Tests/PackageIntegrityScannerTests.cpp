@@ -0,0 +1,103 @@
+#include "PackageIntegrityScanner.h"
+
+#include "AutomationHelpers.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/PackageFileSummary.h"
+
+using UE::AssetValidation::AutomationFlags;
+
+BEGIN_DEFINE_SPEC(FAutomationSpec_PackageIntegrityScanner, "AssetValidation.PackageIntegrityScanner", AutomationFlags)
+	TUniquePtr<UE::AssetValidation::FPackageIntegrityScanner> Scanner;
+	TArray<uint8> PackageBytes;
+	FString TestFilename;
+
+	/** Write package bytes to a temporary file and scan it */
+	TArray<UE::AssetValidation::FPackageIntegrityIssue> ScanBytes(TConstArrayView<uint8> Bytes);
+	/** @return whether any error issue message contains a given string */
+	static bool HasError(TConstArrayView<UE::AssetValidation::FPackageIntegrityIssue> Issues, const TCHAR* Message);
+END_DEFINE_SPEC(FAutomationSpec_PackageIntegrityScanner)
+
+TArray<UE::AssetValidation::FPackageIntegrityIssue> FAutomationSpec_PackageIntegrityScanner::ScanBytes(TConstArrayView<uint8> Bytes)
+{
+	TArray<UE::AssetValidation::FPackageIntegrityIssue> Issues;
+	if (TestTrue(TEXT("Write test package"), FFileHelper::SaveArrayToFile(Bytes, *TestFilename)))
+	{
+		Scanner->ScanPackageFile(TestFilename, Issues);
+	}
+	return Issues;
+}
+
+bool FAutomationSpec_PackageIntegrityScanner::HasError(TConstArrayView<UE::AssetValidation::FPackageIntegrityIssue> Issues, const TCHAR* Message)
+{
+	return Issues.ContainsByPredicate([Message](const UE::AssetValidation::FPackageIntegrityIssue& Issue)
+	{
+		return Issue.Severity == EMessageSeverity::Error && Issue.Message.ToString().Contains(Message);
+	});
+}
+
+void FAutomationSpec_PackageIntegrityScanner::Define()
+{
+	BeforeEach([this]
+	{
+		FString PackageFilename;
+		TestTrue(TEXT("Engine package exists"), FPackageName::DoesPackageExist(TEXT("/Engine/BasicShapes/Cube"), &PackageFilename));
+		TestTrue(TEXT("Read engine package"), FFileHelper::LoadFileToArray(PackageBytes, *PackageFilename));
+
+		Scanner = MakeUnique<UE::AssetValidation::FPackageIntegrityScanner>(IAssetRegistry::GetChecked());
+		TestFilename = FPaths::AutomationTransientDir() / TEXT("PackageIntegrityScannerTest") + FPackageName::GetAssetPackageExtension();
+	});
+
+	AfterEach([this]
+	{
+		IFileManager::Get().Delete(*TestFilename, false, true, true);
+		Scanner.Reset();
+		PackageBytes.Empty();
+	});
+
+	It("Should not report errors for an intact package", [this]
+	{
+		const TArray<UE::AssetValidation::FPackageIntegrityIssue> Issues = ScanBytes(PackageBytes);
+		for (const UE::AssetValidation::FPackageIntegrityIssue& Issue: Issues)
+		{
+			TestTrue(*Issue.Message.ToString(), Issue.Severity != EMessageSeverity::Error);
+		}
+	});
+
+	It("Should report a package with invalid tag", [this]
+	{
+		TArray<uint8> Bytes = PackageBytes;
+		FMemory::Memzero(Bytes.GetData(), sizeof(uint32));
+
+		TestTrue(TEXT("Bad tag"), HasError(ScanBytes(Bytes), TEXT("invalid tag")));
+	});
+
+	It("Should report a package with incomplete summary", [this]
+	{
+		// keep package tag and legacy file version only
+		const TArray<uint8> Bytes{PackageBytes.GetData(), 8};
+
+		TestTrue(TEXT("Bad summary"), HasError(ScanBytes(Bytes), TEXT("package file summary")));
+	});
+
+	It("Should report a package truncated inside of the header", [this]
+	{
+		FPackageFileSummary Summary;
+		FMemoryReader Reader{PackageBytes};
+		Reader << Summary;
+		if (!TestFalse(TEXT("Read summary"), Reader.IsError()) || !TestTrue(TEXT("Summary is smaller than header"), Reader.Tell() < Summary.TotalHeaderSize))
+		{
+			return;
+		}
+
+		// summary is intact, name, import and export maps are cut off
+		const TArray<uint8> Bytes{PackageBytes.GetData(), static_cast<int32>(Reader.Tell())};
+
+		TestTrue(TEXT("Truncated header"), HasError(ScanBytes(Bytes), TEXT("truncated")));
+	});
+}
@@ -0,0 +1,47 @@
+#include "PackageVerdictCache.h"
+
+#include "AutomationHelpers.h"
+#include "PropertyValidationSettings.h"
+#include "Misc/AutomationTest.h"
+
+using UE::AssetValidation::AutomationFlags;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAutomationTest_PackageVerdictCache, "AssetValidation.PackageVerdictCache", AutomationFlags)
+
+bool FAutomationTest_PackageVerdictCache::RunTest(const FString& Parameters)
+{
+	using UE::AssetValidation::EPackageVerdict;
+
+	UPropertyValidationSettings* Settings = NewObject<UPropertyValidationSettings>(GetTransientPackage());
+	Settings->PackagesToIgnore = {TEXT("/VerdictCacheTest/Ignored"), TEXT("/VerdictCacheTest/Project/Ignored")};
+	Settings->PackagesToIterate = {TEXT("/VerdictCacheTest/Iterated")};
+	Settings->bSkipBlueprintGeneratedClasses = false;
+
+	const TArray<FString> ProjectPackages{TEXT("/VerdictCacheTest/Project")};
+
+	UE::AssetValidation::FPackageVerdictCache Cache;
+	Cache.Rebuild(*Settings, ProjectPackages);
+
+	auto GetVerdict = [&Cache](const TCHAR* PackageName)
+	{
+		return Cache.GetVerdict(CreatePackage(PackageName));
+	};
+
+	UTEST_EQUAL(TEXT("Ignored package"), GetVerdict(TEXT("/VerdictCacheTest/Ignored/Asset")), EPackageVerdict::Ignore);
+	UTEST_EQUAL(TEXT("Prefix match is case insensitive"), GetVerdict(TEXT("/verdictcachetest/IGNORED/OtherAsset")), EPackageVerdict::Ignore);
+	// package paths are matched as string prefixes, same as FString::StartsWith
+	UTEST_EQUAL(TEXT("Sibling path with the same prefix"), GetVerdict(TEXT("/VerdictCacheTest/IgnoredSibling/Asset")), EPackageVerdict::Ignore);
+	UTEST_EQUAL(TEXT("Path shorter than prefix"), GetVerdict(TEXT("/VerdictCacheTest/Ignore")), EPackageVerdict::None);
+	UTEST_EQUAL(TEXT("Unrelated package"), GetVerdict(TEXT("/VerdictCacheTest/Other/Asset")), EPackageVerdict::None);
+	UTEST_EQUAL(TEXT("Iterated package"), GetVerdict(TEXT("/VerdictCacheTest/Iterated/Asset")), EPackageVerdict::Iterate);
+	// project packages are never ignored, even if they match ignore list
+	UTEST_EQUAL(TEXT("Project package"), GetVerdict(TEXT("/VerdictCacheTest/Project/Asset")), EPackageVerdict::Iterate);
+	UTEST_EQUAL(TEXT("Ignored project package"), GetVerdict(TEXT("/VerdictCacheTest/Project/Ignored/Asset")), EPackageVerdict::Iterate);
+
+	// cached verdicts are discarded on rebuild
+	Settings->PackagesToIgnore.Reset();
+	Cache.Rebuild(*Settings, ProjectPackages);
+	UTEST_EQUAL(TEXT("Ignored package after rebuild"), GetVerdict(TEXT("/VerdictCacheTest/Ignored/Asset")), EPackageVerdict::None);
+
+	return true;
+}
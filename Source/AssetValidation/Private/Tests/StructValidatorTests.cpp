@@ -85,6 +85,22 @@ bool FAutomationTest_StructProperties::RunTest(const FString& Parameters)
 	return !HasAnyErrors();
 }
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FAutomationTest_StructOffGameThread, FStructValidatorAutomationTest,
+                                        "PropertyValidation.OffGameThreadStructs", AutomationFlags)
+
+bool FAutomationTest_StructOffGameThread::RunTest(const FString& Parameters)
+{
+	// structs that may load soft referenced objects during validation should be validated on the game thread
+	UPropertyValidatorSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPropertyValidatorSubsystem>();
+	check(Subsystem);
+
+	UTEST_TRUE(TEXT("Plain struct"), Subsystem->CanValidateStructOffGameThread(FValidationStruct::StaticStruct()));
+	UTEST_FALSE(TEXT("Recursive soft objects"), Subsystem->CanValidateStructOffGameThread(FSoftObjectRecursiveStruct::StaticStruct()));
+	UTEST_FALSE(TEXT("Nested recursive soft objects"), Subsystem->CanValidateStructOffGameThread(FNestedSoftObjectRecursiveStruct::StaticStruct()));
+
+	return !HasAnyErrors();
+}
+
 IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FAutomationTest_PropertyTypes, FStructValidatorAutomationTest,
                                         "PropertyValidation.PropertyTypes", AutomationFlags)
 
@@ -124,6 +140,8 @@ UValidationTestObject_SoftClassPath::UValidationTestObject_SoftClassPath()
 	EmptyPathArray.AddDefaulted();
 	BadPath			= FString{TEXT("/Script/Class/That/Doesnt/Exist.Name")};
 	Struct.BadPath	= FString{TEXT("/Script/Class/That/Doesnt/Exist.Name")};
+	MetaClassPath	= FString{TEXT("/Script/Engine.Pawn")};
+	BadMetaClassPath = FString{TEXT("/Script/Engine.Texture2D")};
 }
 
 IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FAutomationTest_SoftClassPath, FStructValidatorAutomationTest,
@@ -131,8 +149,8 @@ IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FAutomationTest_SoftClassPath, FStructVa
 
 bool FAutomationTest_SoftClassPath::RunTest(const FString& Parameters)
 {
-	// SoftObjectPath struct value should be validated
-	return ValidateObject<UValidationTestObject_SoftClassPath>(5);
+	// SoftClassPath struct value should be validated, class should match property meta class
+	return ValidateObject<UValidationTestObject_SoftClassPath>(6);
 }
 
 FGameplayTag CreateInvalidTag()
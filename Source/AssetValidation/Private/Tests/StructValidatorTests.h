@@ -26,6 +26,24 @@ struct FValidationStruct
 	}
 };
 
+USTRUCT(meta = (Hidden))
+struct FSoftObjectRecursiveStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, meta = (ValidateRecursive))
+	TArray<TSoftObjectPtr<UObject>> Objects;
+};
+
+USTRUCT(meta = (Hidden))
+struct FNestedSoftObjectRecursiveStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, meta = (ValidateRecursive))
+	FSoftObjectRecursiveStruct Struct;
+};
+
 UCLASS(HideDropdown)
 class UValidationTestObject_StructValidation: public UObject
 {
@@ -116,6 +134,12 @@ class UValidationTestObject_SoftClassPath: public UObject
 
 	UPROPERTY(EditAnywhere, meta = (Validate))
 	FSoftClassPathStruct Struct;
+
+	UPROPERTY(EditAnywhere, meta = (Validate, MetaClass = "/Script/Engine.Actor"))
+	FSoftClassPath MetaClassPath;
+
+	UPROPERTY(EditAnywhere, meta = (Validate, MetaClass = "/Script/Engine.Actor"))
+	FSoftClassPath BadMetaClassPath;
 };
 
 USTRUCT(meta = (Hidden))
@@ -0,0 +1,53 @@
+#include "ValidationResultCacheTests.h"
+
+#include "AutomationHelpers.h"
+#include "ValidationResultCache.h"
+#include "Misc/AutomationTest.h"
+
+using UE::AssetValidation::AutomationFlags;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAutomationTest_DataTableRowKeys, "AssetValidation.ValidationResultCache.DataTableRowKeys", AutomationFlags)
+
+bool FAutomationTest_DataTableRowKeys::RunTest(const FString& Parameters)
+{
+	UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage());
+	DataTable->RowStruct = FValidationCacheTestRow::StaticStruct();
+
+	FValidationCacheTestRow Row;
+	Row.Value = 1;
+	Row.Label = TEXT("Row");
+	DataTable->AddRow(TEXT("First"), Row);
+	DataTable->AddRow(TEXT("Second"), Row);
+	Row.Value = 2;
+	DataTable->AddRow(TEXT("Third"), Row);
+
+	const UE::AssetValidation::FDataTableRowHasher Hasher{DataTable};
+	auto GetRowKeys = [&Hasher, DataTable]
+	{
+		TMap<FName, FIoHash> RowKeys;
+		for (const TPair<FName, uint8*>& RowPair: DataTable->GetRowMap())
+		{
+			RowKeys.Add(RowPair.Key, Hasher.GetRowKey(RowPair.Value));
+		}
+		return RowKeys;
+	};
+
+	const TMap<FName, FIoHash> CachedKeys = GetRowKeys();
+	UTEST_FALSE(TEXT("Row is cacheable"), CachedKeys[TEXT("First")].IsZero());
+	// row key depends on row data only, rows with the same data share validation results
+	UTEST_EQUAL(TEXT("Identical rows"), CachedKeys[TEXT("First")], CachedKeys[TEXT("Second")]);
+	UTEST_NOT_EQUAL(TEXT("Different rows"), CachedKeys[TEXT("First")], CachedKeys[TEXT("Third")]);
+
+	// edited row misses the cache, other rows still hit it
+	DataTable->FindRow<FValidationCacheTestRow>(TEXT("Second"), TEXT(""))->Label = TEXT("Edited");
+	const TMap<FName, FIoHash> EditedKeys = GetRowKeys();
+	UTEST_NOT_EQUAL(TEXT("Edited row"), EditedKeys[TEXT("Second")], CachedKeys[TEXT("Second")]);
+	UTEST_EQUAL(TEXT("Unchanged row"), EditedKeys[TEXT("First")], CachedKeys[TEXT("First")]);
+	UTEST_EQUAL(TEXT("Unchanged row"), EditedKeys[TEXT("Third")], CachedKeys[TEXT("Third")]);
+
+	// reverted row hits the cache again
+	DataTable->FindRow<FValidationCacheTestRow>(TEXT("Second"), TEXT(""))->Label = TEXT("Row");
+	UTEST_EQUAL(TEXT("Reverted row"), GetRowKeys()[TEXT("Second")], CachedKeys[TEXT("Second")]);
+
+	return true;
+}
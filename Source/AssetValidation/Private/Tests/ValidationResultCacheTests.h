@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Engine/DataTable.h"
+
+#include "ValidationResultCacheTests.generated.h"
+
+USTRUCT(meta = (Hidden))
+struct FValidationCacheTestRow: public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	int32 Value = 0;
+
+	UPROPERTY(EditAnywhere)
+	FString Label;
+};
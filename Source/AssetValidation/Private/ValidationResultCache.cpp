@@ -0,0 +1,929 @@
+#include "ValidationResultCache.h"
+
+#include "AssetValidationDefines.h"
+#include "AssetValidationSettings.h"
+#include "AssetValidationStatics.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidatorSubsystem.h"
+#include "ExternalPackageHelper.h"
+#include "PropertyExtensionTypes.h"
+#include "PropertyValidationSettings.h"
+#include "PropertyValidatorSubsystem.h"
+#include "Algo/AllOf.h"
+#include "Algo/Unique.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/DataTable.h"
+#include "Engine/Level.h"
+#include "Hash/Blake3.h"
+#include "HAL/FileManager.h"
+#include "Misc/DataValidation.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "PropertyValidators/PropertyValidatorBase.h"
+#include "Serialization/ArchiveUObject.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace UE::AssetValidation
+{
+/** Increment to discard validation results written by previous versions */
+static constexpr int32 ValidationCacheVersion = 4;
+/** Increment to discard data table row results written by previous versions */
+static constexpr int32 DataTableRowCacheVersion = 2;
+
+static TUniquePtr<FDataTableRowCache> SharedRowCache;
+
+template <typename T>
+static void UpdateHash(FBlake3& Hasher, const T& Value)
+{
+	Hasher.Update(&Value, sizeof(T));
+}
+
+static void UpdateHash(FBlake3& Hasher, const FString& Value)
+{
+	Hasher.Update(*Value, Value.Len() * sizeof(TCHAR));
+}
+
+/** Hash config properties of an object */
+static void UpdateConfigHash(FBlake3& Hasher, const UObject* Object)
+{
+	for (TFieldIterator<FProperty> It{Object->GetClass()}; It; ++It)
+	{
+		if (It->HasAnyPropertyFlags(CPF_Config))
+		{
+			FString Value;
+			It->ExportTextItem_InContainer(Value, Object, nullptr, nullptr, PPF_None);
+			UpdateHash(Hasher, It->GetName());
+			UpdateHash(Hasher, Value);
+		}
+	}
+}
+
+/** Describe property meta data extensions as strings, so that they can be hashed in a stable order */
+static void GatherExtensionEntries(TConstArrayView<FPropertyMetaDataExtension> Extensions, TArray<FString>& OutEntries)
+{
+	for (const FPropertyMetaDataExtension& Extension: Extensions)
+	{
+		FString Entry = GetPathNameSafe(Extension.Struct) + TEXT(":") + Extension.PropertyPath.ToString();
+
+		TArray<TPair<FName, FString>> MetaData = Extension.MetaDataMap.Array();
+		MetaData.Sort([](const TPair<FName, FString>& Lhs, const TPair<FName, FString>& Rhs) { return Lhs.Key.LexicalLess(Rhs.Key); });
+		for (const TPair<FName, FString>& Pair: MetaData)
+		{
+			Entry += FString::Printf(TEXT(";%s=%s"), *Pair.Key.ToString(), *Pair.Value);
+		}
+		OutEntries.Add(MoveTemp(Entry));
+	}
+}
+
+/** Hash property meta data extension entries. Extension sets are discovered in arbitrary order, so entries are sorted first */
+static void UpdateExtensionHash(FBlake3& Hasher, TArray<FString>& Entries)
+{
+	Entries.Sort();
+	UpdateHash(Hasher, Entries.Num());
+	for (const FString& Entry: Entries)
+	{
+		UpdateHash(Hasher, Entry);
+	}
+}
+
+/** Hash binary timestamp of a module that implements a native class, so that validator code changes invalidate the cache */
+static void UpdateModuleHash(FBlake3& Hasher, const UClass* NativeClass, TSet<FName>& VisitedModules)
+{
+	const FName ModuleName = FPackageName::GetShortFName(NativeClass->GetOutermost()->GetFName());
+	
+	bool bAlreadyVisited = false;
+	VisitedModules.Add(ModuleName, &bAlreadyVisited);
+	if (bAlreadyVisited)
+	{
+		return;
+	}
+	
+	const FString ModuleFilename = FModuleManager::Get().GetModuleFilename(ModuleName);
+	if (!ModuleFilename.IsEmpty())
+	{
+		UpdateHash(Hasher, IFileManager::Get().GetTimeStamp(*ModuleFilename).GetTicks());
+	}
+}
+
+/** Hash package saved hash of a package, or its name if package doesn't have package data (e.g. script packages) */
+static void UpdatePackageHash(FBlake3& Hasher, IAssetRegistry& AssetRegistry, FName PackageName)
+{
+	UpdateHash(Hasher, PackageName.ToString());
+
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+	if (PackageData.IsSet())
+	{
+		UpdateHash(Hasher, PackageData->GetPackageSavedHash());
+	}
+}
+
+/** Gather packages of all external actors and external objects of a world, world validation validates them regardless of validation request */
+static void GetWorldExternalPackages(IAssetRegistry& AssetRegistry, FName WorldPackageName, TArray<FName>& OutPackages)
+{
+	const FString PackageName = WorldPackageName.ToString();
+	
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.PackagePaths.Add(FName{ULevel::GetExternalActorsPath(PackageName)});
+	Filter.PackagePaths.Add(FName{FExternalPackageHelper::GetExternalObjectsPath(PackageName)});
+
+	TArray<FAssetData> ExternalAssets;
+	AssetRegistry.GetAssets(Filter, ExternalAssets);
+	for (const FAssetData& ExternalAsset: ExternalAssets)
+	{
+		OutPackages.Add(ExternalAsset.PackageName);
+	}
+}
+
+/** @return world package name of an external actor or object, NAME_None if asset is not an external asset */
+static FName GetOuterWorldPackage(const FAssetData& AssetData)
+{
+	if (!UE::AssetValidation::IsExternalAsset(AssetData) || AssetData.GetOptionalOuterPathName().IsNone())
+	{
+		return NAME_None;
+	}
+
+	return FName{FSoftObjectPath{AssetData.GetOptionalOuterPathName().ToString()}.GetLongPackageName()};
+}
+
+/** @return true if package is loaded and has unsaved changes */
+static bool IsPackageDirty(FName PackageName)
+{
+	const UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName);
+	return Package != nullptr && Package->IsDirty();
+}
+
+FValidationResultCache::FValidationResultCache()
+{
+	LoadCache();
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().AddRaw(this, &FValidationResultCache::HandleAssetRemoved);
+		AssetRegistry->OnAssetUpdated().AddRaw(this, &FValidationResultCache::HandleAssetUpdated);
+		AssetRegistry->OnAssetRenamed().AddRaw(this, &FValidationResultCache::HandleAssetRenamed);
+	}
+	
+	UPackage::PackageSavedWithContextEvent.AddRaw(this, &FValidationResultCache::HandlePackageSaved);
+}
+
+FValidationResultCache::~FValidationResultCache()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+		AssetRegistry->OnAssetUpdated().RemoveAll(this);
+		AssetRegistry->OnAssetRenamed().RemoveAll(this);
+	}
+	
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+	
+	SaveCache();
+}
+
+void FValidationResultCache::BeginRequest(const UEditorValidatorSubsystem& Subsystem, const FValidateAssetsSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FValidationResultCache::BeginRequest, AssetValidationChannel);
+
+	FBlake3 Hasher;
+	UpdateHash(Hasher, ValidationCacheVersion);
+	UpdateHash(Hasher, static_cast<uint8>(Settings.ValidationUsecase));
+	UpdateHash(Hasher, Settings.bLoadAssetsForValidation);
+	UpdateHash(Hasher, Settings.bCaptureAssetLoadLogs);
+	UpdateHash(Hasher, Settings.bCaptureLogsDuringValidation);
+
+	TSet<FName> VisitedModules;
+	// validation subsystem and property validators live in asset validation module
+	UpdateModuleHash(Hasher, UAssetValidationSettings::StaticClass(), VisitedModules);
+	UpdateConfigHash(Hasher, UAssetValidationSettings::Get());
+	UpdateConfigHash(Hasher, UPropertyValidationSettings::Get());
+
+	if (const UPropertyValidatorSubsystem* PropertyValidators = UPropertyValidatorSubsystem::Get())
+	{
+		// property extensions add validation meta data to properties of any class, unsaved extension changes are hashed as well
+		TArray<FString> ExtensionEntries;
+		for (const TPair<FSoftObjectPath, TArray<FPropertyMetaDataExtension>>& Pair: PropertyValidators->GetPropertyExtensionMap())
+		{
+			GatherExtensionEntries(Pair.Value, ExtensionEntries);
+		}
+		UpdateExtensionHash(Hasher, ExtensionEntries);
+	}
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	Subsystem.ForEachEnabledValidator([&Hasher, &VisitedModules, &AssetRegistry](UEditorValidatorBase* Validator)
+	{
+		const UClass* ValidatorClass = Validator->GetClass();
+		UpdateHash(Hasher, ValidatorClass->GetPathName());
+		UpdateConfigHash(Hasher, Validator);
+
+		if (!ValidatorClass->IsNative())
+		{
+			// blueprint validator
+			UpdatePackageHash(Hasher, AssetRegistry, ValidatorClass->GetOutermost()->GetFName());
+		}
+
+		for (const UClass* Class = ValidatorClass; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			if (Class->IsNative())
+			{
+				UpdateModuleHash(Hasher, Class, VisitedModules);
+			}
+		}
+		return true;
+	});
+
+	ValidatorsHash = FIoHash{Hasher.Finalize()};
+}
+
+FIoHash FValidationResultCache::GetAssetKey(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, TConstArrayView<FAssetData> ExternalObjects) const
+{
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName);
+	if (!PackageData.IsSet() || PackageData->GetPackageSavedHash().IsZero() || IsPackageDirty(AssetData.PackageName))
+	{
+		return FIoHash::Zero;
+	}
+
+	FBlake3 Hasher;
+	UpdateHash(Hasher, ValidatorsHash);
+	UpdateHash(Hasher, AssetData.GetObjectPathString());
+	UpdateHash(Hasher, PackageData->GetPackageSavedHash());
+
+	TArray<FName> ExternalPackages;
+	for (const FAssetData& ExternalObject: ExternalObjects)
+	{
+		ExternalPackages.Add(ExternalObject.PackageName);
+	}
+	if (UE::AssetValidation::IsWorldAsset(AssetData))
+	{
+		// world validation covers every external actor of the world, not only the ones passed with the request
+		GetWorldExternalPackages(AssetRegistry, AssetData.PackageName, ExternalPackages);
+	}
+	ExternalPackages.Sort(FNameLexicalLess{});
+	ExternalPackages.SetNum(Algo::Unique(ExternalPackages));
+
+	for (const FName& ExternalPackage: ExternalPackages)
+	{
+		if (IsPackageDirty(ExternalPackage))
+		{
+			return FIoHash::Zero;
+		}
+		UpdatePackageHash(Hasher, AssetRegistry, ExternalPackage);
+	}
+
+	TArray<FName> Dependencies;
+	AssetRegistry.GetDependencies(AssetData.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+	// dependency order is not stable between asset registry scans
+	Dependencies.Sort(FNameLexicalLess{});
+
+	// every hard dependency is a part of the key, as any dependency change can affect validation result
+	for (const FName& Dependency: Dependencies)
+	{
+		if (IsPackageDirty(Dependency))
+		{
+			return FIoHash::Zero;
+		}
+		UpdatePackageHash(Hasher, AssetRegistry, Dependency);
+	}
+
+	return FIoHash{Hasher.Finalize()};
+}
+
+bool FValidationResultCache::HasResult(const FAssetData& AssetData, const FIoHash& Key) const
+{
+	if (Key.IsZero())
+	{
+		return false;
+	}
+	
+	const FCachedResult* CachedResult = Results.Find(AssetData.GetObjectPathString());
+	return CachedResult != nullptr && CachedResult->Key == Key;
+}
+
+bool FValidationResultCache::FindResult(const FAssetData& AssetData, const FIoHash& Key, EDataValidationResult& OutResult, FDataValidationContext& OutContext) const
+{
+	if (Key.IsZero())
+	{
+		return false;
+	}
+
+	const FCachedResult* CachedResult = Results.Find(AssetData.GetObjectPathString());
+	if (CachedResult == nullptr || CachedResult->Key != Key)
+	{
+		return false;
+	}
+
+	OutResult = static_cast<EDataValidationResult>(CachedResult->Result);
+	for (const FCachedMessage& Message: CachedResult->Messages)
+	{
+		const FText Text = FText::FromString(Message.Text);
+		if (Message.Severity == EMessageSeverity::Error)
+		{
+			OutContext.AddError(Text);
+		}
+		else if (Message.Severity == EMessageSeverity::Warning)
+		{
+			OutContext.AddWarning(Text);
+		}
+		else
+		{
+			OutContext.AddMessage(Message.Severity, Text);
+		}
+	}
+
+	return true;
+}
+
+void FValidationResultCache::AddResult(const FAssetData& AssetData, const FIoHash& Key, EDataValidationResult Result, const FDataValidationContext& Context)
+{
+	if (Key.IsZero())
+	{
+		return;
+	}
+
+	FCachedResult& CachedResult = Results.FindOrAdd(AssetData.GetObjectPathString());
+	CachedResult.Key = Key;
+	CachedResult.Result = static_cast<uint8>(Result);
+	CachedResult.Messages.Reset();
+
+	for (const FDataValidationContext::FIssue& Issue: Context.GetIssues())
+	{
+		// tokenized messages are replayed as plain text
+		FText Text = Issue.TokenizedMessage.IsValid() ? Issue.TokenizedMessage->ToText() : Issue.Message;
+		CachedResult.Messages.Add(FCachedMessage{Issue.Severity, Text.ToString()});
+	}
+
+	bCacheDirty = true;
+}
+
+void FValidationResultCache::SaveCache()
+{
+	if (!bCacheDirty)
+	{
+		return;
+	}
+
+	bCacheDirty = false;
+
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Writer{IFileManager::Get().CreateFileWriter(*Filename)})
+	{
+		int32 Version = ValidationCacheVersion;
+		*Writer << Version;
+		*Writer << Results;
+	}
+	else
+	{
+		UE_LOG(LogAssetValidation, Warning, TEXT("ValidationResultCache: failed to write validation cache to %s"), *Filename);
+	}
+}
+
+void FValidationResultCache::LoadCache()
+{
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Reader{IFileManager::Get().CreateFileReader(*Filename)})
+	{
+		int32 Version = 0;
+		*Reader << Version;
+		if (Version == ValidationCacheVersion)
+		{
+			*Reader << Results;
+		}
+
+		if (Reader->IsError())
+		{
+			Results.Reset();
+		}
+	}
+}
+
+bool FValidationResultCache::IsAffectedByDependency(const FAssetData& AssetData, TConstArrayView<FAssetData> DependencyAssets)
+{
+	const UClass* AssetClass = AssetData.GetClass();
+	if (AssetClass == nullptr || DependencyAssets.IsEmpty())
+	{
+		// unknown asset class or dependency without assets (e.g. script package), assume that asset affects the dependency
+		return true;
+	}
+
+	for (const FAssetData& DependencyAsset: DependencyAssets)
+	{
+		if (DependencyAsset.IsRedirector())
+		{
+			// redirector doesn't change by itself, but it may point to an asset of the same class family
+			return true;
+		}
+		
+		const UClass* DependencyClass = DependencyAsset.GetClass();
+		if (DependencyClass == nullptr || AssetClass->IsChildOf(DependencyClass))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FValidationResultCache::InvalidatePackage(IAssetRegistry& AssetRegistry, FName PackageName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FValidationResultCache::InvalidatePackage, AssetValidationChannel);
+	
+	RemovePackageResults(AssetRegistry, PackageName);
+
+	// external packages are not dependencies of their world, but they're a part of the world cache key
+	TArray<FAssetData> PackageAssets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, true);
+	for (const FAssetData& Asset: PackageAssets)
+	{
+		InvalidateOuterWorld(AssetRegistry, Asset);
+	}
+
+	// walk hard referencers, looking through redirectors the same way UAssetValidator_Referencers does.
+	// Package is a part of referencer cache keys, so their results are discarded regardless of asset class
+	TSet<FName> ProcessedPackages{PackageName};
+	TArray<FName> Packages{PackageName};
+	TArray<FName> Referencers;
+	TArray<FAssetData> ReferencerAssets;
+	while (Packages.Num())
+	{
+		const FName Package = Packages.Pop();
+		
+		Referencers.Reset();
+		AssetRegistry.GetReferencers(Package, Referencers, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+		for (const FName& Referencer: Referencers)
+		{
+			bool bAlreadyProcessed = false;
+			ProcessedPackages.Add(Referencer, &bAlreadyProcessed);
+			if (bAlreadyProcessed)
+			{
+				continue;
+			}
+
+			ReferencerAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(Referencer, ReferencerAssets, true);
+
+			if (ReferencerAssets.ContainsByPredicate([](const FAssetData& Asset) { return Asset.IsRedirector(); }))
+			{
+				// encountered redirector, search further
+				Packages.Add(Referencer);
+			}
+			RemovePackageResults(AssetRegistry, Referencer);
+		}
+	}
+
+	// UAssetValidator_Referencers validates referencers of the same class family as a part of asset validation,
+	// so cached results of dependencies are affected by the package if its class is a child of dependency class
+	TArray<FAssetData> ChangedAssets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, ChangedAssets, true);
+
+	ProcessedPackages.Reset();
+	ProcessedPackages.Add(PackageName);
+	Packages.Reset();
+	Packages.Add(PackageName);
+	TArray<FName> Dependencies;
+	TArray<FAssetData> DependencyAssets;
+	while (Packages.Num())
+	{
+		const FName Package = Packages.Pop();
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(Package, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+		for (const FName& Dependency: Dependencies)
+		{
+			bool bAlreadyProcessed = false;
+			ProcessedPackages.Add(Dependency, &bAlreadyProcessed);
+			if (bAlreadyProcessed)
+			{
+				continue;
+			}
+
+			DependencyAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssets, true);
+
+			bool bAffected = false;
+			for (const FAssetData& DependencyAsset: DependencyAssets)
+			{
+				if (DependencyAsset.IsRedirector())
+				{
+					// encountered redirector, search further
+					Packages.Add(Dependency);
+				}
+				else
+				{
+					for (const FAssetData& ChangedAsset: ChangedAssets)
+					{
+						bAffected |= IsAffectedByDependency(ChangedAsset, MakeArrayView(&DependencyAsset, 1));
+					}
+				}
+			}
+
+			if (bAffected)
+			{
+				RemovePackageResults(AssetRegistry, Dependency);
+			}
+		}
+	}
+}
+
+void FValidationResultCache::InvalidateOuterWorld(IAssetRegistry& AssetRegistry, const FAssetData& AssetData)
+{
+	if (const FName WorldPackage = GetOuterWorldPackage(AssetData); !WorldPackage.IsNone())
+	{
+		InvalidatePackage(AssetRegistry, WorldPackage);
+	}
+}
+
+void FValidationResultCache::RemovePackageResults(IAssetRegistry& AssetRegistry, FName PackageName)
+{
+	TArray<FAssetData> PackageAssets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, true);
+
+	for (const FAssetData& Asset: PackageAssets)
+	{
+		if (Results.Remove(Asset.GetObjectPathString()) > 0)
+		{
+			bCacheDirty = true;
+		}
+	}
+}
+
+void FValidationResultCache::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	if (Results.Remove(AssetData.GetObjectPathString()) > 0)
+	{
+		bCacheDirty = true;
+	}
+	// removed asset may be already gone from the asset registry, so its world is invalidated explicitly
+	InvalidateOuterWorld(IAssetRegistry::GetChecked(), AssetData);
+	InvalidatePackage(IAssetRegistry::GetChecked(), AssetData.PackageName);
+}
+
+void FValidationResultCache::HandleAssetUpdated(const FAssetData& AssetData)
+{
+	InvalidatePackage(IAssetRegistry::GetChecked(), AssetData.PackageName);
+}
+
+void FValidationResultCache::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (Results.Remove(OldObjectPath) > 0)
+	{
+		bCacheDirty = true;
+	}
+	InvalidatePackage(IAssetRegistry::GetChecked(), AssetData.PackageName);
+}
+
+void FValidationResultCache::HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	// asset registry may update package data after the package is saved, don't rely on package saved hash
+	InvalidatePackage(IAssetRegistry::GetChecked(), Package->GetFName());
+}
+
+FString FValidationResultCache::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetValidation") / TEXT("ValidationCache.bin");
+}
+
+static void UpdateStructLayoutHash(FBlake3& Hasher, const UPropertyValidatorSubsystem* PropertyValidators, const UStruct* Struct, TSet<const UStruct*>& VisitedStructs);
+
+/** Hash property type, offset and meta data, including inner properties of containers */
+static void UpdatePropertyLayoutHash(FBlake3& Hasher, const UPropertyValidatorSubsystem* PropertyValidators, const FProperty* Property, TSet<const UStruct*>& VisitedStructs)
+{
+	UpdateHash(Hasher, Property->GetName());
+	UpdateHash(Hasher, Property->GetCPPType());
+	UpdateHash(Hasher, Property->GetOffset_ForInternal());
+	UpdateHash(Hasher, Property->PropertyFlags);
+
+	// validation meta specifiers change validation result as much as property values do
+	if (const TMap<FName, FString>* MetaDataMap = Property->GetMetaDataMap())
+	{
+		TArray<TPair<FName, FString>> MetaData = MetaDataMap->Array();
+		MetaData.Sort([](const TPair<FName, FString>& Lhs, const TPair<FName, FString>& Rhs) { return Lhs.Key.LexicalLess(Rhs.Key); });
+		for (const TPair<FName, FString>& Pair: MetaData)
+		{
+			UpdateHash(Hasher, Pair.Key.ToString());
+			UpdateHash(Hasher, Pair.Value);
+		}
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		UpdateStructLayoutHash(Hasher, PropertyValidators, StructProperty->Struct, VisitedStructs);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		UpdatePropertyLayoutHash(Hasher, PropertyValidators, ArrayProperty->Inner, VisitedStructs);
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		UpdatePropertyLayoutHash(Hasher, PropertyValidators, SetProperty->ElementProp, VisitedStructs);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		UpdatePropertyLayoutHash(Hasher, PropertyValidators, MapProperty->KeyProp, VisitedStructs);
+		UpdatePropertyLayoutHash(Hasher, PropertyValidators, MapProperty->ValueProp, VisitedStructs);
+	}
+}
+
+/** Hash layout of struct properties and property extensions merged into its validation plan, nested structs are hashed once */
+static void UpdateStructLayoutHash(FBlake3& Hasher, const UPropertyValidatorSubsystem* PropertyValidators, const UStruct* Struct, TSet<const UStruct*>& VisitedStructs)
+{
+	bool bAlreadyVisited = false;
+	VisitedStructs.Add(Struct, &bAlreadyVisited);
+
+	UpdateHash(Hasher, Struct->GetPathName());
+	if (bAlreadyVisited)
+	{
+		return;
+	}
+
+	if (PropertyValidators != nullptr)
+	{
+		// validation plan merges extensions of a struct and all of its super structs
+		TArray<FString> ExtensionEntries;
+		for (const UStruct* ExtendedStruct = Struct; ExtendedStruct != nullptr; ExtendedStruct = ExtendedStruct->GetSuperStruct())
+		{
+			GatherExtensionEntries(PropertyValidators->GetPropertyExtensions(ExtendedStruct), ExtensionEntries);
+		}
+		UpdateExtensionHash(Hasher, ExtensionEntries);
+	}
+
+	for (TFieldIterator<FProperty> It{Struct}; It; ++It)
+	{
+		UpdatePropertyLayoutHash(Hasher, PropertyValidators, *It, VisitedStructs);
+	}
+}
+
+/**
+ * Archive that hashes serialized row data instead of writing it
+ * Object references are hashed by path and package hash of referenced package, so that row key doesn't depend on object addresses
+ */
+class FRowHashArchive: public FArchiveUObject
+{
+public:
+	FRowHashArchive(const FDataTableRowHasher& InRowHasher, FBlake3& InHasher)
+		: RowHasher(InRowHasher)
+		, Hasher(InHasher)
+	{
+		SetIsSaving(true);
+		SetIsPersistent(true);
+	}
+
+	FORCEINLINE bool IsCacheable() const { return bCacheable; }
+
+	using FArchiveUObject::operator<<;
+
+	//~Begin FArchive interface
+	virtual FString GetArchiveName() const override { return TEXT("FRowHashArchive"); }
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		Hasher.Update(Data, Num);
+	}
+	virtual FArchive& operator<<(FName& Name) override
+	{
+		UpdateHash(Hasher, Name.ToString());
+		return *this;
+	}
+	virtual FArchive& operator<<(UObject*& Object) override
+	{
+		if (Object == nullptr)
+		{
+			UpdateHash(Hasher, FString{});
+		}
+		else if (Object->IsIn(RowHasher.GetDataTable()))
+		{
+			// instanced objects are not hashed, their changes can't be tracked
+			bCacheable = false;
+		}
+		else
+		{
+			UpdateHash(Hasher, Object->GetPathName());
+			HashPackage(Object->GetPackage()->GetFName());
+		}
+		return *this;
+	}
+	virtual FArchive& operator<<(FSoftObjectPath& Path) override
+	{
+		UpdateHash(Hasher, Path.ToString());
+		if (!Path.IsNull())
+		{
+			HashPackage(Path.GetLongPackageFName());
+		}
+		return *this;
+	}
+	//~End FArchive interface
+
+private:
+	void HashPackage(FName PackageName)
+	{
+		const FIoHash PackageHash = RowHasher.GetPackageHash(PackageName);
+		if (PackageHash.IsZero())
+		{
+			bCacheable = false;
+		}
+		UpdateHash(Hasher, PackageHash);
+	}
+
+	const FDataTableRowHasher& RowHasher;
+	FBlake3& Hasher;
+	bool bCacheable = true;
+};
+
+FDataTableRowHasher::FDataTableRowHasher(const UDataTable* InDataTable)
+	: DataTable(InDataTable)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(FDataTableRowHasher::FDataTableRowHasher, AssetValidationChannel);
+	check(DataTable && DataTable->GetRowStruct());
+
+	FBlake3 Hasher;
+	UpdateHash(Hasher, DataTableRowCacheVersion);
+	UpdateConfigHash(Hasher, UPropertyValidationSettings::Get());
+
+	// property validators may be implemented in project modules, property validator subsystem may be overridden as well
+	TSet<FName> VisitedModules;
+	TArray<UClass*> ValidatorClasses;
+	GetDerivedClasses(UPropertyValidatorBase::StaticClass(), ValidatorClasses, true);
+	ValidatorClasses.Add(UPropertyValidatorBase::StaticClass());
+	const UPropertyValidatorSubsystem* PropertyValidators = UPropertyValidatorSubsystem::Get();
+	if (PropertyValidators != nullptr)
+	{
+		ValidatorClasses.Add(PropertyValidators->GetClass());
+	}
+
+	for (const UClass* ValidatorClass: ValidatorClasses)
+	{
+		for (const UClass* Class = ValidatorClass; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			if (Class->IsNative())
+			{
+				UpdateModuleHash(Hasher, Class, VisitedModules);
+			}
+		}
+	}
+
+	TSet<const UStruct*> VisitedStructs;
+	UpdateStructLayoutHash(Hasher, PropertyValidators, DataTable->GetRowStruct(), VisitedStructs);
+
+	TableHash = FIoHash{Hasher.Finalize()};
+}
+
+FIoHash FDataTableRowHasher::GetRowKey(const uint8* RowData) const
+{
+	FBlake3 Hasher;
+	UpdateHash(Hasher, TableHash);
+
+	FRowHashArchive Archive{*this, Hasher};
+	const_cast<UScriptStruct*>(DataTable->GetRowStruct())->SerializeItem(Archive, const_cast<uint8*>(RowData), nullptr);
+
+	return Archive.IsCacheable() ? FIoHash{Hasher.Finalize()} : FIoHash::Zero;
+}
+
+FIoHash FDataTableRowHasher::GetPackageHash(FName PackageName) const
+{
+	{
+		FReadScopeLock ReadLock{PackageHashLock};
+		if (const FIoHash* PackageHash = PackageHashes.Find(PackageName))
+		{
+			return *PackageHash;
+		}
+	}
+
+	FIoHash PackageHash = FIoHash::Zero;
+	if (!IsPackageDirty(PackageName))
+	{
+		FBlake3 Hasher;
+		// package name is hashed as well, so that packages without package data (e.g. script packages) have a valid hash
+		UpdatePackageHash(Hasher, IAssetRegistry::GetChecked(), PackageName);
+		PackageHash = FIoHash{Hasher.Finalize()};
+	}
+
+	FWriteScopeLock WriteLock{PackageHashLock};
+	return PackageHashes.Add(PackageName, PackageHash);
+}
+
+FDataTableRowCache* FDataTableRowCache::Get()
+{
+	return SharedRowCache.Get();
+}
+
+void FDataTableRowCache::Initialize()
+{
+	if (!SharedRowCache.IsValid())
+	{
+		SharedRowCache = MakeUnique<FDataTableRowCache>();
+	}
+}
+
+void FDataTableRowCache::Shutdown()
+{
+	SharedRowCache.Reset();
+}
+
+FDataTableRowCache::FDataTableRowCache()
+{
+	LoadCache();
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().AddRaw(this, &FDataTableRowCache::HandleAssetRemoved);
+		AssetRegistry->OnAssetRenamed().AddRaw(this, &FDataTableRowCache::HandleAssetRenamed);
+	}
+}
+
+FDataTableRowCache::~FDataTableRowCache()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+		AssetRegistry->OnAssetRenamed().RemoveAll(this);
+	}
+
+	SaveCache();
+}
+
+const TMap<FIoHash, FDataTableRowResult>* FDataTableRowCache::FindRows(const UDataTable* DataTable) const
+{
+	return Tables.Find(DataTable->GetPathName());
+}
+
+void FDataTableRowCache::SetRows(const UDataTable* DataTable, TMap<FIoHash, FDataTableRowResult>&& Rows)
+{
+	TMap<FIoHash, FDataTableRowResult>& CachedRows = Tables.FindOrAdd(DataTable->GetPathName());
+	
+	// row results are defined by row keys, so the same set of keys means that nothing has changed
+	const bool bSameRows = CachedRows.Num() == Rows.Num() && Algo::AllOf(Rows, [&CachedRows](const TPair<FIoHash, FDataTableRowResult>& Row)
+	{
+		return CachedRows.Contains(Row.Key);
+	});
+	
+	if (!bSameRows)
+	{
+		CachedRows = MoveTemp(Rows);
+		bCacheDirty = true;
+	}
+}
+
+void FDataTableRowCache::SaveCache()
+{
+	if (!bCacheDirty)
+	{
+		return;
+	}
+
+	bCacheDirty = false;
+
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Writer{IFileManager::Get().CreateFileWriter(*Filename)})
+	{
+		int32 Version = DataTableRowCacheVersion;
+		*Writer << Version;
+		*Writer << Tables;
+	}
+	else
+	{
+		UE_LOG(LogAssetValidation, Warning, TEXT("DataTableRowCache: failed to write data table row cache to %s"), *Filename);
+	}
+}
+
+void FDataTableRowCache::LoadCache()
+{
+	const FString Filename = GetCacheFilename();
+	if (TUniquePtr<FArchive> Reader{IFileManager::Get().CreateFileReader(*Filename)})
+	{
+		int32 Version = 0;
+		*Reader << Version;
+		if (Version == DataTableRowCacheVersion)
+		{
+			*Reader << Tables;
+		}
+
+		if (Reader->IsError())
+		{
+			Tables.Reset();
+		}
+	}
+}
+
+void FDataTableRowCache::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	if (Tables.Remove(AssetData.GetObjectPathString()) > 0)
+	{
+		bCacheDirty = true;
+	}
+}
+
+void FDataTableRowCache::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (Tables.Remove(OldObjectPath) > 0)
+	{
+		bCacheDirty = true;
+	}
+}
+
+FString FDataTableRowCache::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetValidation") / TEXT("DataTableRowCache.bin");
+}
+
+} // UE::AssetValidation
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+#include "Logging/TokenizedMessage.h"
+
+class IAssetRegistry;
+class FDataValidationContext;
+class FObjectPostSaveContext;
+class UDataTable;
+class UEditorValidatorSubsystem;
+struct FAssetData;
+struct FValidateAssetsSettings;
+enum class EDataValidationResult : uint8;
+
+namespace UE::AssetValidation
+{
+/**
+ * Validation Result Cache
+ * Persistent cache of asset validation results, used to skip loading and validation of assets that haven't changed.
+ * Cache key for an asset is a hash of:
+ *  - package saved hash of an asset and its external objects. Worlds include all external actors and objects found in the asset registry
+ *  - package saved hashes of all hard package dependencies
+ *  - enabled validators, their configuration and binaries of modules they're implemented in
+ * Cached validation messages are replayed to validation context on cache hit
+ *
+ * When a package changes during editor session, cached results of its hard referencers are discarded, as well as results of a world
+ * if package is one of its external actors or objects. Results of its dependencies
+ * are discarded as well if they could include the package validated by UAssetValidator_Referencers, which picks referencers of
+ * the same class family: blueprints validate blueprints, material functions validate material functions, and so on
+ */
+class FValidationResultCache
+{
+public:
+	FValidationResultCache();
+	~FValidationResultCache();
+
+	FValidationResultCache(const FValidationResultCache&) = delete;
+	FValidationResultCache& operator=(const FValidationResultCache&) = delete;
+
+	/** Compute hash of enabled validators and validation settings, should be called before each validation request */
+	void BeginRequest(const UEditorValidatorSubsystem& Subsystem, const FValidateAssetsSettings& Settings);
+
+	/** @return cache key for an asset, zero hash if asset validation result can't be cached, e.g. asset has unsaved changes */
+	FIoHash GetAssetKey(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, TConstArrayView<FAssetData> ExternalObjects) const;
+
+	/** @return true if cached result exists for an asset key */
+	bool HasResult(const FAssetData& AssetData, const FIoHash& Key) const;
+
+	/**
+	 * Replay cached validation messages to validation context
+	 * @return true if cached result was found for an asset key
+	 */
+	bool FindResult(const FAssetData& AssetData, const FIoHash& Key, EDataValidationResult& OutResult, FDataValidationContext& OutContext) const;
+
+	/** Store asset validation result and messages of validation context */
+	void AddResult(const FAssetData& AssetData, const FIoHash& Key, EDataValidationResult Result, const FDataValidationContext& Context);
+
+	/** Write cache to disk, if it has changed */
+	void SaveCache();
+
+	/** Discard cached results of a package, its referencers and dependencies that validate it as a referencer */
+	void InvalidatePackage(IAssetRegistry& AssetRegistry, FName PackageName);
+
+	/** @return true if asset is of the same class family as a dependency, so that dependency validates it with UAssetValidator_Referencers */
+	static bool IsAffectedByDependency(const FAssetData& AssetData, TConstArrayView<FAssetData> DependencyAssets);
+
+private:
+	struct FCachedMessage
+	{
+		EMessageSeverity::Type Severity = EMessageSeverity::Info;
+		FString Text;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedMessage& Message)
+		{
+			uint8 Severity = static_cast<uint8>(Message.Severity);
+			Ar << Severity;
+			Message.Severity = static_cast<EMessageSeverity::Type>(Severity);
+			Ar << Message.Text;
+			return Ar;
+		}
+	};
+
+	struct FCachedResult
+	{
+		FIoHash Key;
+		uint8 Result = 0;
+		TArray<FCachedMessage> Messages;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedResult& CachedResult)
+		{
+			Ar << CachedResult.Key;
+			Ar << CachedResult.Result;
+			Ar << CachedResult.Messages;
+			return Ar;
+		}
+	};
+
+	void LoadCache();
+	static FString GetCacheFilename();
+
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	/** Discard cached results of a world, if asset is its external actor or object */
+	void InvalidateOuterWorld(IAssetRegistry& AssetRegistry, const FAssetData& AssetData);
+	/** Discard cached results of assets in a package */
+	void RemovePackageResults(IAssetRegistry& AssetRegistry, FName PackageName);
+
+	/** cached validation results, keyed by asset object path */
+	TMap<FString, FCachedResult> Results;
+	/** hash of enabled validators and validation settings for a running validation request */
+	FIoHash ValidatorsHash;
+	bool bCacheDirty = false;
+};
+
+/** Cached property validation result of a data table row */
+struct FDataTableRowResult
+{
+	uint8 Result = 0;
+	TArray<FString> Errors;
+	TArray<FString> Warnings;
+
+	friend FArchive& operator<<(FArchive& Ar, FDataTableRowResult& RowResult)
+	{
+		Ar << RowResult.Result;
+		Ar << RowResult.Errors;
+		Ar << RowResult.Warnings;
+		return Ar;
+	}
+};
+
+/**
+ * Data Table Row Hasher
+ * Computes cache keys of data table rows. Row key is a hash of:
+ *  - row struct layout: properties, their types, offsets and meta data, including nested structs and containers
+ *  - property validation settings and binaries of modules that implement property validators
+ *  - row data serialized with tagged properties. Referenced objects are hashed by path and package saved hash of their package,
+ *    so that changes in referenced assets invalidate rows that may validate them recursively
+ * Row that references an object from the data table itself or an asset with unsaved changes can't be cached
+ */
+class FDataTableRowHasher
+{
+public:
+	explicit FDataTableRowHasher(const UDataTable* InDataTable);
+
+	/** @return cache key of a row, zero hash if row can't be cached. Thread safe */
+	FIoHash GetRowKey(const uint8* RowData) const;
+
+	/** @return package saved hash of a referenced package, zero hash if package has unsaved changes. Thread safe */
+	FIoHash GetPackageHash(FName PackageName) const;
+
+	FORCEINLINE const UDataTable* GetDataTable() const { return DataTable; }
+
+private:
+	const UDataTable* DataTable = nullptr;
+	/** hash of row struct layout and property validation environment */
+	FIoHash TableHash;
+
+	/** package saved hashes of referenced packages */
+	mutable TMap<FName, FIoHash> PackageHashes;
+	mutable FRWLock PackageHashLock;
+};
+
+/**
+ * Data Table Row Cache
+ * Persistent cache of property validation results of data table rows, keyed by FDataTableRowHasher row keys.
+ * Rows that haven't changed since last validation replay their cached issues, so only edited and added rows are validated.
+ * Each data table stores only rows from its last validation, so that cache doesn't grow with row edits
+ */
+class FDataTableRowCache
+{
+public:
+	/** @return data table row cache, nullptr if module is not initialized */
+	static FDataTableRowCache* Get();
+	static void Initialize();
+	static void Shutdown();
+
+	FDataTableRowCache();
+	~FDataTableRowCache();
+
+	/** @return cached row results of a data table mapped by row key, nullptr if data table isn't cached */
+	const TMap<FIoHash, FDataTableRowResult>* FindRows(const UDataTable* DataTable) const;
+
+	/** Replace cached rows of a data table */
+	void SetRows(const UDataTable* DataTable, TMap<FIoHash, FDataTableRowResult>&& Rows);
+
+	/** Write cache to disk, if it has changed */
+	void SaveCache();
+
+private:
+	void LoadCache();
+	static FString GetCacheFilename();
+
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	/** cached row results mapped by row key, keyed by data table object path */
+	TMap<FString, TMap<FIoHash, FDataTableRowResult>> Tables;
+	bool bCacheDirty = false;
+};
+
+} // UE::AssetValidation
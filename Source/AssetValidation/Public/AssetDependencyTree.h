@@ -1,26 +1,16 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
 
 class IAssetRegistry;
+class FObjectPostSaveContext;
 struct FAssetData;
 
-/**
- * AssetTreeNode
- */
-struct ASSETVALIDATION_API FAssetTreeNode
+namespace UE::AssetValidation
 {
-	FAssetTreeNode() = default;
-	FAssetTreeNode(IAssetRegistry& AssetRegistry, const FAssetData& InAssetData);
-
-	bool IsValid() const;
-
-	FAssetData AssetData;
-	float TotalDiskSizeBytes = 0.f;
-	float TotalMemorySizeBytes = 0.f;
-	
-	TArray<TSharedPtr<FAssetTreeNode>> Children;
-};
+	class FAssetSizeProvider;
+}
 
 /**
  * AssetAuditResult
@@ -29,19 +19,19 @@ struct ASSETVALIDATION_API FAssetAuditResult
 {
 	FAssetAuditResult() = default;
 	explicit FAssetAuditResult(const FAssetData& InAssetData);
-	
+
 	FAssetData AssetData;
+	/** disk size of an asset and its unique dependencies, each dependency is counted once */
 	float TotalDiskSizeBytes = 0.f;
+	/** memory size of an asset and its unique dependencies, each dependency is counted once */
 	float TotalMemorySizeBytes = 0.f;
+	/** disk size of an asset and its dependencies, dependency is counted once for each path it is referenced by */
+	float InclusiveDiskSizeBytes = 0.f;
+	/** memory size of an asset and its dependencies, dependency is counted once for each path it is referenced by */
+	float InclusiveMemorySizeBytes = 0.f;
 	int32 TotalDependencyCount = 0;
 	int32 MaxDependencyBreadth = 0;
 	int32 DependencyDepth = 0;
-
-	FORCEINLINE void Add(const TSharedPtr<FAssetTreeNode>& AssetNode)
-	{
-		TotalDiskSizeBytes += AssetNode->TotalDiskSizeBytes;
-		TotalMemorySizeBytes += AssetNode->TotalMemorySizeBytes;
-	}
 };
 
 /**
@@ -49,29 +39,129 @@ struct ASSETVALIDATION_API FAssetAuditResult
  * Provides general information about asset and its HARD references
  * Unlike AssetRegistry, dependencies are stored as AssetData, which makes subsequent queries faster
  * The main reason though is that it handles recursive dependency iteration for you
- * @todo: tree is not usable multiple times, it gives invalid results
- * @todo: thread safety for adding/removing nodes
- * @todo: asset data invalidation
- * @todo: cache referencers as well
- * @todo: make it a dependency graph instead
+ *
+ * Dependency graph is persistent: nodes are stored in a flat array and reference each other by index. Node sizes, dependencies,
+ * depths and audit results are memoized and invalidated when AssetRegistry reports that package was added, removed or updated.
+ * Use FAssetDependencyTree::Get() to share the graph between validators and commandlets.
+ *
+ * Audit collapses circular dependencies (strongly connected components) into a single node, then computes depth and breadth
+ * in a single pass over the condensed graph, processing each topological level in parallel. Components memoized by a previous audit are skipped.
+ * Total sizes are summed over unique reachable components of each audited asset, so shared dependencies are counted once.
+ * Inclusive sizes are aggregated in the same pass as depth, so shared dependencies are counted once per referencing path.
+ * @todo: not only hard dependencies
  */
 class ASSETVALIDATION_API FAssetDependencyTree
 {
 public:
+	FAssetDependencyTree();
 	~FAssetDependencyTree();
-	
+
+	FAssetDependencyTree(const FAssetDependencyTree&) = delete;
+	FAssetDependencyTree& operator=(const FAssetDependencyTree&) = delete;
+
+	/** @return dependency tree shared between asset validators and commandlets */
+	static FAssetDependencyTree& Get();
+	/** Destroy shared dependency tree */
+	static void Shutdown();
+
 	/**
-	 * Produce an asset audit result by recursively iterating over asset dependencies. Works similar to Size Map, only worse
+	 * Produce an asset audit result by iterating over asset dependencies. Works similar to Size Map, only worse
 	 * @return true if operation was successful
 	 */
 	bool AuditAsset(IAssetRegistry& AssetRegistry, const FAssetData& Asset, FAssetAuditResult& OutResult);
-	
-protected:
 
+	/**
+	 * Produce audit results for multiple assets at once. Shared dependencies are resolved once per batch
+	 * @return true if all assets were audited successfully
+	 */
+	bool AuditAssets(IAssetRegistry& AssetRegistry, TConstArrayView<FAssetData> Assets, TArray<FAssetAuditResult>& OutResults);
+
+	/** Invalidate cached data for a package and every package that depends on it */
+	void InvalidatePackage(FName PackageName);
+
+	/** Discard the whole dependency graph */
 	void Reset();
-	
-	static TSharedPtr<FAssetTreeNode> CreateAssetNode(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, FAssetDependencyTree& DependencyTree, TSet<FName>& VisitedAssets);
-	static void AuditAsset(const TSharedPtr<FAssetTreeNode>& TreeNode, FAssetAuditResult& OutResult, int32 CurrentDepth = 1);
 
-	TMap<FAssetIdentifier, TSharedPtr<FAssetTreeNode>> TreeNodes;
+	/**
+	 * Allow audit to unload assets that were loaded for size estimation, once their number exceeds UAssetValidationSettings::AuditUnloadBatchSize.
+	 * Unloading runs garbage collection, so it should be enabled only if caller doesn't hold unreferenced pointers to loaded objects
+	 */
+	void SetAllowAssetUnloading(bool bAllow);
+
+	/** Unload assets that were loaded for size estimation */
+	void UnloadAssets();
+
+protected:
+	using FNodeIndex = int32;
+
+	struct FAssetNode
+	{
+		FAssetData AssetData;
+		float DiskSizeBytes = 0.f;
+		float MemorySizeBytes = 0.f;
+		/** indices of packages this node depends on */
+		TArray<FNodeIndex> Dependencies;
+		/** indices of packages that depend on this node, used for invalidation */
+		TArray<FNodeIndex> Referencers;
+
+		/** memoized dependency depth, including node itself. Circular dependencies count as a single level */
+		int32 DependencyDepth = 0;
+		/** memoized max number of direct dependencies across node and its dependencies */
+		int32 MaxDependencyBreadth = 0;
+		/** memoized inclusive sizes, circular dependencies count as a single node */
+		double InclusiveDiskSizeBytes = 0.0;
+		double InclusiveMemorySizeBytes = 0.0;
+		/** memoized audit result for node as a root */
+		FAssetAuditResult AuditResult;
+
+		uint8 bAllocated: 1 = false;
+		uint8 bSizeValid: 1 = false;
+		uint8 bDependenciesValid: 1 = false;
+		/** whether depth, breadth and inclusive sizes are valid. If set, it is set for every dependency as well */
+		uint8 bAggregateValid: 1 = false;
+		/** whether audit result is valid. If set, aggregate data is valid as well */
+		uint8 bAuditResultValid: 1 = false;
+	};
+
+	/** @return node index for a given asset, allocates a new node if necessary */
+	FNodeIndex FindOrAddNode(const FAssetData& AssetData);
+	/** Update node size and dependencies if they were invalidated */
+	void ResolveNode(IAssetRegistry& AssetRegistry, FNodeIndex NodeIndex);
+	/** Resolve every node reachable from root nodes. Resolving a node may load an asset, so it has to be done on game thread */
+	void ResolveReachableNodes(IAssetRegistry& AssetRegistry, TConstArrayView<FNodeIndex> RootNodes, TArray<FNodeIndex>& OutReachableNodes);
+	/** Compute aggregate data for reachable nodes and audit results for root nodes */
+	void ComputeAuditResults(TConstArrayView<FNodeIndex> RootNodes, TConstArrayView<FNodeIndex> ReachableNodes);
+	/** Invalidate node and memoized data of every node that (indirectly) depends on it */
+	void InvalidateNode(FNodeIndex NodeIndex, bool bInvalidateDependencies);
+	void RemoveNode(FNodeIndex NodeIndex);
+
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	/** Invalidate or remove package node, changes are deferred while audit is in progress */
+	void HandlePackageChanged(FName PackageName, bool bRemoved);
+	/** Apply package changes reported while audit was in progress */
+	void ApplyPendingChanges();
+	/** Invalidate package and packages that reference it according to asset registry */
+	void InvalidatePackageWithReferencers(FName PackageName);
+
+	/** dependency graph nodes, nodes reference each other by index */
+	TArray<FAssetNode> Nodes;
+	/** indices of removed nodes that can be reused */
+	TArray<FNodeIndex> FreeNodes;
+	/** map between package name and node index */
+	TMap<FName, FNodeIndex> NodeIndices;
+	/** packages changed while audit was in progress, mapped to whether package was removed */
+	TMap<FName, bool> PendingChanges;
+	/** whether audit is in progress, asset registry events may be triggered by loading assets during the audit */
+	bool bAuditInProgress = false;
+	/** whether audit can unload assets loaded for size estimation */
+	bool bAllowAssetUnloading = false;
+
+	/** estimates asset sizes, avoiding asset loading when possible */
+	TUniquePtr<UE::AssetValidation::FAssetSizeProvider> SizeProvider;
+
+	mutable FCriticalSection CriticalSection;
 };
@@ -41,6 +41,42 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Settings")
 	int32 NumAssetsToShowCancelButton = 100;
 
+	/**
+	 * If true, validators that can run in parallel mode are executed on worker threads for batches of assets,
+	 * after the rest of the validators have finished with the batch. Messages are still reported in asset order
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings")
+	bool bEnableParallelValidation = false;
+
+	/** number of assets in a single parallel validation batch */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", meta = (EditCondition = "bEnableParallelValidation", ClampMin = "1"))
+	int32 ParallelValidationBatchSize = 32;
+
+	/** number of upcoming assets to load asynchronously while current assets are validated. Zero disables prefetching */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", meta = (ClampMin = "0"))
+	int32 NumAssetsToPrefetch = 8;
+
+	/**
+	 * Used physical memory in megabytes, after which validation runs garbage collection to unload assets it has already validated.
+	 * Memory is checked after each validated batch. Zero disables memory trimming
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", meta = (ClampMin = "0"))
+	int32 ValidationMemoryHighWaterMarkMB = 16384;
+
+	/**
+	 * If true, validation results are stored on disk and reused for assets that haven't changed since. Cached result is keyed by
+	 * package saved hash, hashes of hard dependencies and a hash of enabled validators and their configuration
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings")
+	bool bUseValidationCache = true;
+
+	/**
+	 * If true, property validation results of data table rows are stored on disk and reused for rows that haven't changed since.
+	 * Cached row result is keyed by a hash of row data and row struct layout, so only edited and added rows are validated
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Settings")
+	bool bUseDataTableRowCache = true;
+
 	/** If true, will fill validation log with messages like "Validating thingy" or "Done validating thingy" */
 	UPROPERTY(EditAnywhere, Config, Category = "Settings")
 	bool bEnabledDetailedAssetLogging = false;
@@ -53,6 +89,18 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Settings")
 	bool bOpenEditorWorldForUnloadedActors = true;
 
+	/** AssetRegistry tags that store estimated asset memory size in bytes. Used by asset audits to avoid loading assets */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit")
+	TArray<FName> MemorySizeAssetTags;
+
+	/** If true, asset audits store measured memory sizes on disk and reuse them until package is saved again */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit")
+	bool bUseAssetSizeCache = true;
+
+	/** number of assets loaded for size estimation, after which audit commandlet unloads them */
+	UPROPERTY(EditAnywhere, Config, Category = "Audit", meta = (ClampMin = "1"))
+	int32 AuditUnloadBatchSize = 256;
+
 	/** Default filter to use for @UAssetValidationCommandlet execution if no other filter is specified */
 	UPROPERTY(EditAnywhere, Config, Category = "Settings")
 	TSubclassOf<UAVCommandletSearchFilter> CommandletDefaultFilter;
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <mutex>
-
 #include "CoreMinimal.h"
 #include "Misc/DataValidation.h"
 
@@ -17,47 +15,84 @@ enum class EDataValidationUsecase : uint8;
 namespace UE::AssetValidation
 {
 
+/** Defines which threads a log capture scope captures messages from */
+enum class ELogCaptureScope : uint8
+{
+	/**
+	 * Messages logged by any thread while scope is active, e.g. by async loading thread or asset compilation workers.
+	 * Scope should be opened on the game thread, otherwise it captures messages of the current thread only
+	 */
+	Process,
+	/** Messages logged by the thread that opened the scope, e.g. by a worker running parallel validators */
+	Thread
+};
+
+/**
+ * Captures warnings and errors logged while capture scope is active.
+ * A single output device is installed for the lifetime of the module, it routes each log line to the innermost capture scope
+ * active on the emitting thread, or to the innermost process wide scope if emitting thread doesn't have one.
+ * Thread scope lines are stored in a per-thread buffer without any locks, process scope lines are stored in a shared buffer.
+ * Lines are converted to strings only when capture scope ends. Capture scopes should be strictly nested on a thread
+ */
+class FScopedLogCapture
+{
+public:
+	explicit FScopedLogCapture(bool bInEnabled = true, ELogCaptureScope Scope = ELogCaptureScope::Process);
+	~FScopedLogCapture();
+
+	FScopedLogCapture(const FScopedLogCapture&) = delete;
+	FScopedLogCapture& operator=(const FScopedLogCapture&) = delete;
+
+	/** Install log capture output device, called on module startup */
+	static void Initialize();
+	/** Remove log capture output device, called on module shutdown */
+	static void Shutdown();
+
+	FORCEINLINE bool IsProcessWide() const { return bProcessWide; }
+
+protected:
+	/** Stop capturing and visit captured messages in the order they were logged. Does nothing if capture was already stopped */
+	void StopCapture(TFunctionRef<void(FString&& Message, ELogVerbosity::Type Verbosity)> Callback);
+
+private:
+	/** capture scope that was active on the thread before this one */
+	FScopedLogCapture* PreviousScope = nullptr;
+	/** process wide capture scope that was active before this one */
+	FScopedLogCapture* PreviousProcessScope = nullptr;
+	/** index of the first message captured by this scope in a capture buffer */
+	int32 FirstMessage = 0;
+	bool bCapturing = false;
+	/** whether scope captures messages from every thread */
+	bool bProcessWide = false;
+};
+
 /**
- * While in scope, any messages received by this output device automatically have asset info added to the tokenized message
+ * While in scope, any messages logged by the game thread or threads it waits for automatically have asset info added to the tokenized message
  * @InAssetData asset data
  * @InContext validation context
  * @InLogConverter additional message post processing
  */
-struct FScopedAssetContext: public FOutputDevice
+struct FScopedAssetContext: public FScopedLogCapture
 {
 	FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext);
 	FScopedAssetContext(const FAssetData& InAssetData, FDataValidationContext& InContext, TFunction<FString(const FString&)> InLogConverter);
 
-	virtual ~FScopedAssetContext() override;
-
-	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
-	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	~FScopedAssetContext();
 
 private:
-	std::recursive_mutex CriticalSection;
 	FAssetData AssetData;
 	FDataValidationContext& Context;
 	TFunction<FString(const FString&)> LogConverter;
 };
 
 /**
- * While in scope, any messages received by this output device 
+ * While in scope, any warnings and errors logged by threads defined by capture scope are gathered
  */
-struct FScopedLogMessageGatherer: public FOutputDevice
+struct FScopedLogMessageGatherer: public FScopedLogCapture
 {
-	explicit FScopedLogMessageGatherer(bool bInEnabled);
-	virtual ~FScopedLogMessageGatherer() override;
-
-	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
-	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	explicit FScopedLogMessageGatherer(bool bInEnabled, ELogCaptureScope Scope = ELogCaptureScope::Process);
 
 	void Stop(TArray<FString>& OutWarnings, TArray<FString>& OutErrors);
-
-private:
-	std::recursive_mutex CriticalSection;
-	TArray<FString> Warnings;
-	TArray<FString> Errors;
-	bool bEnabled = false;
 };
 	
 } // UE::AssetValidation
@@ -112,6 +147,9 @@ namespace UE::AssetValidation
 	/** @return whether asset data represents external actor */
 	bool IsExternalAsset(const FAssetData& AssetData);
 
+	/** @return true if log message contains package name that is not a part of a longer package name */
+	bool MentionsPackage(const FString& Message, const FString& PackageName);
+
 	/** @return true if filename is a C++ source file */
 	bool IsCppFile(const FString& Filename);
 
@@ -196,6 +234,8 @@ namespace Private
 	ASSETVALIDATION_API void AppendMessages(FMessageLog& MessageLog, const FAssetData& AssetData, FDataValidationContext& ValidationContext);
 	/** Transfer gathered messages by the scoped log and transfer them to the Data Validation context */
 	ASSETVALIDATION_API void AppendMessages(FDataValidationContext& ValidationContext, const FAssetData& AssetData, FScopedLogMessageGatherer& Gatherer);
+	/** Transfer issues gathered by @Source validation context to @Target validation context, preserving issue order */
+	ASSETVALIDATION_API void AppendMessages(FDataValidationContext& Target, const FDataValidationContext& Source);
 	/** Add a list of messages related to the @AssetData with a specified @Severity */
 	ASSETVALIDATION_API void AppendMessages(FDataValidationContext& ValidationContext, const FAssetData& AssetData, EMessageSeverity::Type Severity, TConstArrayView<FText> Messages);
 	ASSETVALIDATION_API void AppendMessages(FDataValidationContext& ValidationContext, const FAssetData& AssetData, EMessageSeverity::Type Severity, TConstArrayView<FString> Messages);
@@ -7,6 +7,13 @@
 
 class UAssetValidator;
 
+namespace UE::AssetValidation
+{
+	struct FPendingAssetValidation;
+	class FAssetPrefetcher;
+	class FValidationResultCache;
+}
+
 UCLASS()
 class ASSETVALIDATION_API UAssetValidationSubsystem: public UEditorValidatorSubsystem
 {
@@ -46,6 +53,10 @@ public:
 	{
 		return CastChecked<TValidatorType>(GetValidator(TValidatorType::StaticClass()));
 	}
+
+	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnAssetValidated, const FAssetData& /* AssetData */, EDataValidationResult /* Result */, const FDataValidationContext& /* Context */);
+	/** Called once asset validation result is final, in the same order assets are reported to the message log */
+	FOnAssetValidated OnAssetValidated;
 protected:
 	
 	bool ShouldShowCancelButton(int32 NumAssets, const FValidateAssetsSettings& InSettings) const;
@@ -71,13 +82,42 @@ protected:
 	const FValidateAssetsSettings& 				Settings,
 	FValidateAssetsResults& 					OutResults) const;
 
+	/** @return true if parallel safe validators should be executed on worker threads for a validation request */
+	bool ShouldRunParallelValidation(const FValidateAssetsSettings& InSettings) const;
+	/** Gather enabled validators that can run in parallel mode for a given validation use case */
+	void GatherParallelValidators(EDataValidationUsecase Usecase, TArray<UAssetValidator*>& OutValidators) const;
+	/** Mark validators that run as a part of parallel validation pass as deferred, so that serial validation skips them */
+	void SetValidatorsDeferred(bool bDeferred) const;
+	/** Run parallel safe validators on worker threads for assets that finished serial validation, merge results in deterministic order */
+	void ValidateAssetsParallel(TArrayView<UE::AssetValidation::FPendingAssetValidation> PendingAssets, TConstArrayView<UAssetValidator*> ParallelValidators) const;
+	/** Transfer validation results of pending assets to the message log and validation results, in asset order */
+	void FinishPendingAssets(
+		FMessageLog& 												DataValidationLog,
+		TArrayView<UE::AssetValidation::FPendingAssetValidation>	PendingAssets,
+		const FValidateAssetsSettings& 								InSettings,
+		FValidateAssetsResults& 									OutResults
+	) const;
+	/** @return true if validation results should be reused for unchanged assets */
+	bool ShouldUseValidationCache(const FValidateAssetsSettings& InSettings) const;
+	/** @return true if validation should prefetch upcoming assets with async loading */
+	bool ShouldPrefetchAssets(const FValidateAssetsSettings& InSettings) const;
+	/** @return true if asset would be loaded by validation and can be prefetched */
+	bool CanPrefetchAsset(const FAssetData& AssetData, const FValidateAssetsSettings& InSettings) const;
+	/** @return true if used physical memory exceeded UAssetValidationSettings::ValidationMemoryHighWaterMarkMB and request is not nested into asset validation */
+	bool ShouldTrimMemory(const FValidateAssetsSettings& InSettings) const;
+	/** Unload packages loaded by validation by running garbage collection. Caller shouldn't hold unreferenced pointers to loaded objects */
+	void TrimMemory(TConstArrayView<TWeakObjectPtr<UPackage>> Packages) const;
 	
 	/** @return true if asset not excluded from validation */
 	virtual bool ShouldValidateAsset(const FAssetData& Asset, const FValidateAssetsSettings& Settings, FDataValidationContext& InContext) const override;
 	/** @return true if asset should be pre loaded for validation */
 	bool ShouldLoadAsset(const FAssetData& AssetData) const;
 
-	void MarkAssetDataValidated(const FAssetData& AssetData, EDataValidationResult Result) const;
+	/**
+	 * Mark asset as validated as a part of running validation request
+	 * @param bRecordResult whether to count asset validation result, false if it is recorded by the caller later
+	 */
+	void MarkAssetDataValidated(const FAssetData& AssetData, EDataValidationResult Result, bool bRecordResult = true) const;
 	
 	/** */
 	void ResetValidationState() const;
@@ -98,4 +138,14 @@ protected:
 	TSet<FName> LoadedPackageNames;
 	/** Assets validated as a part of a running validation request */
 	mutable TSet<FAssetData> ValidatedAssets;
+	/** Validators deferred to parallel validation pass of a running validation request */
+	mutable TArray<UAssetValidator*> DeferredValidators;
+	/** Depth of IsAssetValidWithContext calls, used to detect nested validation requests */
+	mutable int32 ValidationDepth = 0;
+	/** true if next top level IsAssetValidWithContext call is a part of parallel validation batch, which records asset result after parallel validators finish */
+	mutable bool bDeferAssetResult = false;
+	/** Prefetches upcoming assets for a running validation request */
+	mutable UE::AssetValidation::FAssetPrefetcher* AssetPrefetcher = nullptr;
+	/** Persistent validation results, created on first use */
+	mutable TSharedPtr<UE::AssetValidation::FValidationResultCache> ValidationCache;
 };
@@ -32,6 +32,10 @@ public:
 	virtual void PostInitProperties() override;
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	//~End UObject interface
+
+	//~Begin EditorValidatorBase interface
+	virtual bool IsEnabled() const override;
+	//~End EditorValidatorBase interface
 	
 	FORCEINLINE bool CanRunParallelMode() const { return bCanRunParallelMode; }
 	FORCEINLINE bool RequiresLoadedAsset() const { return bRequiresLoadedAsset; }
@@ -45,11 +49,35 @@ public:
 		return EDataValidationResult::NotValidated;
 	}
 
+	/**
+	 * Validate asset data or a loaded asset the same way validator subsystem does it, without going through blueprint events.
+	 * Used by parallel validation pass, so validator should be already checked for K2_CanValidate on the game thread
+	 */
+	EDataValidationResult ValidateAssetParallel(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext);
+
+	/**
+	 * Called on the game thread by parallel validation pass, before validator runs for an asset
+	 * @return false if asset should be validated on the game thread, e.g. because its validation may load objects
+	 */
+	virtual bool CanValidateAssetOffGameThread(const FAssetData& InAssetData, UObject* InAsset) const
+	{
+		return true;
+	}
+
+	/** Called on the game thread by parallel validation pass before worker threads start, to build state that validator reads off game thread */
+	virtual void PrepareParallelValidation() {}
+
 	FORCEINLINE void SetEnabled(bool bNewEnabled)
 	{
 		bIsEnabled = bNewEnabled;
 	}
 
+	/** Mark validator as deferred to parallel validation pass. Deferred validators are not reported as enabled to the validator subsystem */
+	FORCEINLINE void SetDeferredToParallelPass(bool bNewDeferred)
+	{
+		bDeferredToParallelPass = bNewDeferred;
+	}
+
 protected:
 	void LogValidatingAssetMessage(const FAssetData& AssetData, FDataValidationContext& Context);
 
@@ -71,4 +99,6 @@ protected:
 	uint8 bRequiresTopLevelAsset: 1 = true;
 	/** Indicates whether validator is an actor validator as well */
 	uint8 bCanValidateActors : 1 = false;
+	/** Indicates whether validator is executed by a parallel validation pass of a running validation request */
+	uint8 bDeferredToParallelPass : 1 = false;
 };
@@ -27,6 +27,15 @@ public:
 	 */
 	static bool GetPackageLoadErrors(const FString& PackageName, const FAssetData& AssetData, FDataValidationContext& ValidationContext);
 
+	/**
+	 * Validate multiple packages at once. Packages that are not loaded yet are issued as async load requests, with no more than
+	 * @MaxConcurrentLoads packages in flight. Load errors and warnings are attributed to packages they mention, other messages
+	 * are reported for the whole batch. Packages loaded by the batch are unloaded by the next garbage collection.
+	 * Packages that are already in memory are validated one by one, see GetPackageLoadErrors
+	 * @return validation result for all packages
+	 */
+	EDataValidationResult ValidateAssetsBatched(TConstArrayView<FAssetData> Assets, FDataValidationContext& ValidationContext, int32 MaxConcurrentLoads);
+
 	UPROPERTY(Config, EditAnywhere, Category = "Asset Validation")
 	TArray<FSoftClassPath> ClassPathsToIgnore;
 };
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetValidators/AssetValidator.h"
+
+#include "AssetValidator_PackageIntegrity.generated.h"
+
+namespace UE::AssetValidation
+{
+	class FPackageIntegrityScanner;
+}
+
+/**
+ * Package Integrity Validator
+ * Validates package file of an asset without loading it: package summary, import and export maps, hard imports and soft package references.
+ * Catches most of the broken references UAssetValidator_LoadPackage does, but doesn't create any UObjects.
+ * Package file on disk is validated, so asset with unsaved changes is skipped
+ */
+UCLASS()
+class ASSETVALIDATION_API UAssetValidator_PackageIntegrity: public UAssetValidator
+{
+	GENERATED_BODY()
+public:
+	UAssetValidator_PackageIntegrity();
+
+	//~Begin EditorValidatorBase interface
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+	virtual EDataValidationResult ValidateAsset_Implementation(const FAssetData& InAssetData, FDataValidationContext& InContext) override;
+	//~End EditorValidatorBase interface
+
+	//~Begin AssetValidator interface
+	virtual void PrepareParallelValidation() override;
+	//~End AssetValidator interface
+
+	/** Report soft package references to packages that don't exist as warnings */
+	UPROPERTY(EditAnywhere, Config, Category = "Asset Validation")
+	bool bCheckSoftReferences = true;
+
+private:
+	/** create package scanner if it doesn't exist or registered classes have changed. Game thread only */
+	void UpdateScanner();
+	
+	/** package scanner, recreated when new script classes are registered */
+	TSharedPtr<UE::AssetValidation::FPackageIntegrityScanner> Scanner;
+	int32 ScannerClassesVersion = INDEX_NONE;
+};
@@ -16,4 +16,8 @@ public:
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 	//~End EditorValidatorBase
+
+	//~Begin AssetValidator
+	virtual bool CanValidateAssetOffGameThread(const FAssetData& InAssetData, UObject* InAsset) const override;
+	//~End AssetValidator
 };
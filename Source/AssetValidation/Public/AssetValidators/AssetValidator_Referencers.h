@@ -17,4 +17,8 @@ public:
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 	//~End		EditorValidatorBase interface
+
+	/** max number of referencer packages that are loaded at the same time */
+	UPROPERTY(EditAnywhere, Config, Category = "Asset Validation", meta = (ClampMin = "1"))
+	int32 MaxConcurrentLoads = 16;
 };
@@ -33,6 +33,9 @@ public:
 	 */
 	virtual void InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params);
 
+	/** @return true if action operates on assets, found by commandlet search filter */
+	virtual bool RequiresAssets() const { return true; }
+
 	/**
 	 * Action implementation should live here
 	 * @return true if action succeeded at completing the operation, false otherwise
@@ -24,9 +24,20 @@ struct FAVCommandletAction_AuditAssetResult: public FAVCommandletActionResultBas
 	UPROPERTY(DisplayName = "Memory Size (MB")
 	float MemorySizeMB = 0.f;
 
+	/** disk size with shared dependencies counted once for each referencer */
+	UPROPERTY(DisplayName = "Inclusive Disk Size (MB)")
+	float InclusiveDiskSizeMB = 0.f;
+
+	/** memory size with shared dependencies counted once for each referencer */
+	UPROPERTY(DisplayName = "Inclusive Memory Size (MB)")
+	float InclusiveMemorySizeMB = 0.f;
+
 	UPROPERTY()
 	int32 DependencyCount = 0;
 
+	UPROPERTY()
+	int32 MaxDependencyBreadth = 0;
+
 	UPROPERTY()
 	int32 DependencyChainDepth = 0;
 };
@@ -43,6 +54,7 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool bDisplaySummary = false;
 	
-	UPROPERTY(EditAnywhere, meta = (EditCondition = "OutputFormat == EOutputFormat::Csv", FilePathFilter = "Csv File (*.csv)|*.csv"))
+	/** Report file, rows are written as CSV or as JSON Lines for .jsonl files */
+	UPROPERTY(EditAnywhere, meta = (FilePathFilter = "Report File (*.csv;*.jsonl)|*.csv;*.jsonl"))
 	FFilePath OutFile;
 };
@@ -46,10 +46,12 @@ class ASSETVALIDATION_API UAVCommandletAction_BlueprintStats: public UAVCommandl
 {
 	GENERATED_BODY()
 public:
+	virtual void InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params) override;
 	virtual bool Run(const TArray<FAssetData>& InAssets) override;
 
 	FAVCommandletAction_BlueprintStatsResult GetBlueprintStats(const UBlueprint* Blueprint, const FAssetData& Asset) const;
 	
-	UPROPERTY(EditAnywhere, meta = (EditCondition = "OutputFormat == EOutputFormat::Csv", FilePathFilter = "Csv File (*.csv)|*.csv"))
+	/** Report file, rows are written as CSV or as JSON Lines for .jsonl files */
+	UPROPERTY(EditAnywhere, meta = (FilePathFilter = "Report File (*.csv;*.jsonl)|*.csv;*.jsonl"))
 	FFilePath OutFile;
 };
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "AVCommandletAction.h"
+
+#include "AVCommandletAction_MergeValidationResults.generated.h"
+
+/**
+ * Merges validation reports written by Validate Assets action, e.g. by multiple sharded commandlet runs,
+ * into a single report. Action fails if any report is missing or any asset is invalid
+ */
+UCLASS(DisplayName = "Merge Validation Results")
+class ASSETVALIDATION_API UAVCommandletAction_MergeValidationResults: public UAVCommandletAction
+{
+	GENERATED_BODY()
+public:
+
+	//~Begin AVCommandletAction interface
+	virtual void InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params) override;
+	virtual bool RequiresAssets() const override { return false; }
+	virtual bool Run(const TArray<FAssetData>& Assets) override;
+	//~End AVCommandletAction interface
+
+	/** Validation reports to merge. Wildcards are supported in file names */
+	UPROPERTY(EditAnywhere, Category = "Action")
+	TArray<FString> ResultFiles;
+
+	/** Json file to write merged validation report to */
+	UPROPERTY(EditAnywhere, Category = "Action", meta = (FilePathFilter = "Json File (*.json)|*.json"))
+	FFilePath OutFile;
+};
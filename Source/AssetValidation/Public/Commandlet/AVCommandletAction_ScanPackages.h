@@ -0,0 +1,26 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "AVCommandletAction.h"
+
+#include "AVCommandletAction_ScanPackages.generated.h"
+
+/**
+ * Scans package files of found assets for integrity issues without loading them, see UAssetValidator_PackageIntegrity.
+ * Packages are scanned on worker threads. Action fails if any package has errors
+ */
+UCLASS(DisplayName = "Scan Packages")
+class ASSETVALIDATION_API UAVCommandletAction_ScanPackages: public UAVCommandletAction
+{
+	GENERATED_BODY()
+public:
+
+	//~Begin AVCommandletAction interface
+	virtual void InitFromCommandlet(const TArray<FString>& Switches, const TMap<FString, FString>& Params) override;
+	virtual bool Run(const TArray<FAssetData>& Assets) override;
+	//~End AVCommandletAction interface
+
+	/** Report soft package references to packages that don't exist as warnings */
+	UPROPERTY(EditAnywhere, Category = "Action")
+	bool bCheckSoftReferences = true;
+};
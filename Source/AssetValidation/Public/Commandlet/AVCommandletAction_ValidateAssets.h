@@ -8,6 +8,68 @@
 
 class UAssetValidator;
 enum class EDataValidationUsecase: uint8;
+struct FValidateAssetsResults;
+
+USTRUCT()
+struct FAVCommandletAction_ValidateAssetResult: public FAVCommandletActionResultBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString PackageName;
+	
+	UPROPERTY()
+	EDataValidationResult Result = EDataValidationResult::NotValidated;
+
+	UPROPERTY()
+	TArray<FString> Warnings;
+
+	UPROPERTY()
+	TArray<FString> Errors;
+};
+
+/** Validation results written by validate assets action, so that results of multiple commandlet runs can be merged */
+USTRUCT()
+struct FAVCommandletValidationReport
+{
+	GENERATED_BODY()
+
+	FAVCommandletValidationReport() = default;
+	explicit FAVCommandletValidationReport(const FValidateAssetsResults& Results);
+
+	/** Append results of another report */
+	void Append(const FAVCommandletValidationReport& Other);
+	
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+
+	UPROPERTY()
+	int32 NumRequested = 0;
+
+	UPROPERTY()
+	int32 NumChecked = 0;
+
+	UPROPERTY()
+	int32 NumValid = 0;
+
+	UPROPERTY()
+	int32 NumInvalid = 0;
+
+	UPROPERTY()
+	int32 NumSkipped = 0;
+
+	UPROPERTY()
+	int32 NumWarnings = 0;
+
+	UPROPERTY()
+	int32 NumUnableToValidate = 0;
+
+	UPROPERTY()
+	bool bAssetLimitReached = false;
+
+	UPROPERTY()
+	TArray<FAVCommandletAction_ValidateAssetResult> Assets;
+};
 
 UCLASS(DisplayName = "Validate Assets")
 class ASSETVALIDATION_API UAVCommandletAction_ValidateAssets: public UAVCommandletAction
@@ -37,6 +99,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Action")
 	bool bSkipExcludedDirectories = true;
 
+	/** If set, validation report is written to a json file. Reports of sharded commandlet runs can be merged with Merge Validation Results action */
+	UPROPERTY(EditAnywhere, Category = "Action", meta = (FilePathFilter = "Json File (*.json)|*.json"))
+	FFilePath OutFile;
+
+	/** If set, result of each asset is streamed to a csv or json lines file as soon as asset is validated */
+	UPROPERTY(EditAnywhere, Category = "Action", meta = (FilePathFilter = "Report File (*.csv;*.jsonl)|*.csv;*.jsonl"))
+	FFilePath ReportFile;
+
 	UPROPERTY()
 	TSet<FName> CommandletDisabledValidators;
 };
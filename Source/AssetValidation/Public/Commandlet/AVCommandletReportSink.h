@@ -0,0 +1,139 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+
+class FArchive;
+
+namespace UE::AssetValidation
+{
+enum class EReportFormat: uint8
+{
+	Csv,
+	JsonLines
+};
+
+/** @return report format deduced from file extension, json lines for .json and .jsonl files, csv otherwise */
+ASSETVALIDATION_API EReportFormat GetReportFormat(const FString& Filename);
+
+/**
+ * Report Row Layout
+ * Column accessors of a report row struct, compiled once per struct. Each column knows how to read its value directly from struct memory,
+ * so rows are formatted without going through property export for common column types.
+ * CSV values other than integers are exported the same way data tables export them, so that CSV reports keep their format.
+ * Container properties are skipped, except for string arrays
+ */
+class ASSETVALIDATION_API FReportRowLayout
+{
+public:
+	explicit FReportRowLayout(const UScriptStruct* InRowStruct);
+
+	/** @return row layout for a struct, shared between all reports of the same struct */
+	static const FReportRowLayout& Get(const UScriptStruct* RowStruct);
+
+	FORCEINLINE const UScriptStruct* GetRowStruct() const { return RowStruct; }
+	FORCEINLINE bool IsEmpty() const { return Columns.IsEmpty(); }
+
+	/** Append column names, separated by commas and terminated by a new line */
+	void AppendCsvHeader(FString& Out) const;
+	/** Append quoted column values, separated by commas and terminated by a new line */
+	void AppendCsvRow(FString& Out, const void* RowData) const;
+	/** Append json object with column values, terminated by a new line */
+	void AppendJsonRow(FString& Out, const void* RowData) const;
+
+private:
+	enum class EColumnType: uint8
+	{
+		Bool,
+		Int32,
+		Int64,
+		Float,
+		Double,
+		Numeric,
+		String,
+		Name,
+		Text,
+		Enum,
+		StringArray,
+		Other
+	};
+
+	struct FColumn
+	{
+		const FProperty* Property = nullptr;
+		/** enum of enum properties and byte properties with enum */
+		const UEnum* Enum = nullptr;
+		/** underlying numeric property of an enum property */
+		const FNumericProperty* UnderlyingProperty = nullptr;
+		FString CsvName;
+		/** json key, standardized the same way FJsonObjectConverter does it */
+		FString JsonName;
+		EColumnType Type = EColumnType::Other;
+	};
+
+	/** Append column value as a plain string */
+	void AppendValue(FString& Out, const FColumn& Column, const void* RowData) const;
+	/** Append column value as a csv value, formatted the same way as data table export */
+	void AppendCsvValue(FString& Out, const FColumn& Column, const void* RowData) const;
+	/** Append column value as a json value */
+	void AppendJsonValue(FString& Out, const FColumn& Column, const void* RowData) const;
+
+	const UScriptStruct* RowStruct = nullptr;
+	TArray<FColumn> Columns;
+};
+
+/**
+ * Report Sink
+ * Streams report rows to a file as they are produced, either as CSV or as JSON Lines. Rows are formatted on the calling thread into a buffer,
+ * that is written to disk by a background task once it grows large enough or enough time has passed since the last write.
+ * File contains every row added before the last write, so a crash doesn't lose the whole report
+ */
+class ASSETVALIDATION_API FReportSink
+{
+public:
+	FReportSink(const FString& InFilename, EReportFormat InFormat, const UScriptStruct* RowStruct);
+	~FReportSink();
+
+	FReportSink(const FReportSink&) = delete;
+	FReportSink& operator=(const FReportSink&) = delete;
+
+	template <typename T>
+	static TUniquePtr<FReportSink> Create(const FString& Filename)
+	{
+		return MakeUnique<FReportSink>(Filename, GetReportFormat(Filename), TBaseStructure<T>::Get());
+	}
+
+	/** @return true if report file was opened */
+	FORCEINLINE bool IsOpen() const { return Writer.IsValid(); }
+
+	template <typename T>
+	void AddRow(const T& Row)
+	{
+		check(TBaseStructure<T>::Get() == Layout.GetRowStruct());
+		AddRow(static_cast<const void*>(&Row));
+	}
+
+	void AddRow(const void* RowData);
+
+	/**
+	 * Write remaining rows and close the file
+	 * @return true if every row was written successfully
+	 */
+	bool Close();
+
+private:
+	/** Hand formatted rows to a background write task */
+	void FlushRows();
+
+	FString Filename;
+	EReportFormat Format;
+	const FReportRowLayout& Layout;
+	TUniquePtr<FArchive> Writer;
+	/** rows that are formatted, but not yet handed to a write task */
+	FString PendingRows;
+	/** last write task, write tasks are chained so that rows are written in order */
+	UE::Tasks::FTask LastWrite;
+	double LastFlushTime = 0.0;
+};
+
+} // UE::AssetValidation
@@ -16,5 +16,10 @@ public:
 
 	virtual int32 Main(const FString& Commandline) override;
 
+	/** Parse shard parameter in Index/Count format, index is zero based */
+	static bool ParseShard(const FString& Value, int32& OutShardIndex, int32& OutNumShards);
+	/** Keep assets that belong to a given shard. Split is deterministic and keeps world packages together with their external objects */
+	static void FilterShardAssets(TArray<FAssetData>& Assets, int32 ShardIndex, int32 NumShards);
+	
 	static void ParseCommandlineParams(UObject* Target, const TArray<FString>& Switches, const TMap<FString, FString>& Params);
 };
@@ -2,16 +2,29 @@
 
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "Modules/ModuleManager.h"
 #include "PropertyExtensionTypes.h"
+#include "Kismet2/StructureEditorUtils.h"
 #include "PropertyValidators/PropertyValidatorBase.h"
 #include "PropertyValidators/PropertyValidationResult.h"
 #include "Templates/NonNullPointer.h"
+#include "UObject/ObjectKey.h"
 
 #include "PropertyValidatorSubsystem.generated.h"
 
 namespace UE::AssetValidation
 {
 	class FMetaDataSource;
+	class FPackageVerdictCache;
+	struct FPropertyValidationPlanEntry;
+	struct FStructValidationPlan;
+
+	/** Validators resolved for a property type */
+	struct FPropertyValidatorDispatch
+	{
+		const UPropertyValidatorBase* PropertyValidator = nullptr;
+		const UPropertyValidatorBase* ContainerValidator = nullptr;
+	};
 }
 using FMetaDataSource = UE::AssetValidation::FMetaDataSource;
 
@@ -33,11 +46,16 @@ struct FPropertyExtensionLibrary
 
 	void InitializePropertyMap();
 	void RequestUpdatePropertyMap();
+	/** Refresh property map if update was requested. Should be called on the game thread, as property map is read by worker threads */
+	void UpdatePropertyMap();
 
 	void AddSet(UPropertyMetaDataExtensionSet* InSet);
 	void RemoveSet(UPropertyMetaDataExtensionSet* InSet);
 
+	/** @return property extensions of a given struct. Read only, property map should be up to date */
 	TConstArrayView<FPropertyMetaDataExtension> GetProperties(const UStruct* InStruct) const;
+	/** @return all property extensions mapped by struct they extend. Read only, property map should be up to date */
+	const TMap<FSoftObjectPath, TArray<FPropertyMetaDataExtension>>& GetPropertyMap() const;
 	
 	FORCEINLINE bool IsInitialized() const { return bInitialized; }
 	FORCEINLINE void Reset() { *this = FPropertyExtensionLibrary{}; }
@@ -65,7 +83,7 @@ protected:
  *
  */
 UCLASS()
-class ASSETVALIDATION_API UPropertyValidatorSubsystem: public UEditorSubsystem
+class ASSETVALIDATION_API UPropertyValidatorSubsystem: public UEditorSubsystem, public FStructureEditorUtils::INotifyOnStructChanged
 {
 	GENERATED_BODY()
 
@@ -80,6 +98,11 @@ public:
 	virtual void Deinitialize() override;
 	//~End USubsystem interface
 
+	//~Begin INotifyOnStructChanged
+	virtual void PreChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override {}
+	virtual void PostChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override;
+	//~End INotifyOnStructChanged
+
 	/**
 	 * @return validation result for given object
 	 * @param Object object to perform full validation on
@@ -91,11 +114,26 @@ public:
 	 * @param OwningObject logically owns script struct (doesn't mean that struct data is a part of object's memory) and indicates object of validation
 	 * @param ScriptStruct struct type to perform full validation
 	 * @param StructData memory that represents @ScriptStruct
+	 * Each call uses its own validation context, so independent struct instances can be validated from worker threads,
+	 * as long as struct data isn't modified, garbage collection can't run during validation and @CanValidateStructOffGameThread is true
 	 */
-	FPropertyValidationResult ValidateStruct(const UObject* OwningObject, const UScriptStruct* ScriptStruct, const uint8* StructData);
+	FPropertyValidationResult ValidateStruct(const UObject* OwningObject, const UScriptStruct* ScriptStruct, const uint8* StructData) const;
+
+	/**
+	 * @return true if struct or class validation never loads objects and can run on worker threads.
+	 * Object properties validated recursively, including ones inside containers and nested structs, may load soft referenced objects
+	 * or reach objects of any class, so structs that have them should be validated on the game thread.
+	 * Instanced structs are not safe either, as validation plans of their payload types may be compiled during validation
+	 */
+	bool CanValidateStructOffGameThread(const UStruct* Struct) const;
+
+	/** @return property meta data extensions declared for a given struct, super struct extensions are not included */
+	TConstArrayView<FPropertyMetaDataExtension> GetPropertyExtensions(const UStruct* Struct) const;
+	/** @return all property meta data extensions, mapped by struct they extend */
+	const TMap<FSoftObjectPath, TArray<FPropertyMetaDataExtension>>& GetPropertyExtensionMap() const;
 
 	template <typename TStructType>
-	FPropertyValidationResult ValidateStruct(const UObject* OwningObject, const TStructType& Value)
+	FPropertyValidationResult ValidateStruct(const UObject* OwningObject, const TStructType& Value) const
 	{
 		return ValidateStruct(OwningObject, TStructType::StaticStruct(), reinterpret_cast<const uint8*>(&Value));
 	}
@@ -137,6 +175,12 @@ public:
 	/** @return whether property can be ever validated based on its property flags */
 	bool CanEverValidateProperty(const FProperty* Property) const;
 
+	/**
+	 * Invalidate compiled validation plans for all structs
+	 * Should be called each time struct layout, property meta data or validation settings are changed
+	 */
+	void InvalidateValidationPlans();
+
 protected:
 	
 	/**
@@ -167,13 +211,43 @@ protected:
 	
 	/** @return whether property should be validated for given @ValidationContext */
 	bool ShouldValidateProperty(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData, FPropertyValidationContext& ValidationContext) const;
+	/** @return whether property should be validated based on property flags, meta data and validation settings. Doesn't depend on validation context */
+	bool ShouldEverValidateProperty(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData) const;
+	/** @return whether property should be validated for a source object of a given @ValidationContext */
+	bool ShouldValidatePropertyInContext(const FProperty* Property, UE::AssetValidation::FMetaDataSource& MetaData, FPropertyValidationContext& ValidationContext) const;
+
+	/** @return validation plan for a given struct, compiled on first use */
+	TSharedRef<UE::AssetValidation::FStructValidationPlan> GetValidationPlan(const UStruct* Struct) const;
+	/** @return validation plan for a given struct that includes properties from the struct, its super structs and property extensions */
+	TSharedRef<UE::AssetValidation::FStructValidationPlan> CompileValidationPlan(const UStruct* Struct) const;
+	/** add property to the validation plan if it can ever be validated */
+	void AddValidationPlanEntry(UE::AssetValidation::FStructValidationPlan& Plan, const FProperty* Property, UE::AssetValidation::FMetaDataSource&& MetaData) const;
+	/** validate property described by a validation plan entry in @ContainerMemory */
+	void ValidatePlanEntryWithContext(TNonNullPtr<const uint8> ContainerMemory, UE::AssetValidation::FPropertyValidationPlanEntry& Entry, FPropertyValidationContext& ValidationContext) const;
+
+	/** rebuild project packages and package verdicts from property validation settings */
+	void RebuildPackageVerdicts();
+
+	/**
+	 * Create validators for property validator classes that don't have one yet
+	 * @return whether new validators were registered
+	 */
+	bool RegisterValidators();
+	/** resolve validators for each property class and each struct type that has a dedicated validator */
+	void RebuildValidatorDispatch();
 
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+	void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+
+	/** @return validators resolved for a given property type, nullptr if property type is unknown */
+	const UE::AssetValidation::FPropertyValidatorDispatch* FindValidatorDispatch(const FProperty* PropertyType) const;
 	/** @return property validator for a given property type */
 	const UPropertyValidatorBase* FindPropertyValidator(const FProperty* PropertyType) const;
 	/** @return container validator for a given property type */
 	const UPropertyValidatorBase* FindContainerValidator(const FProperty* PropertyType) const;
-	/** @return validator from container a given property type */
-	static const UPropertyValidatorBase* FindValidator(const TMap<FPropertyValidatorDescriptor, UPropertyValidatorBase*>& Container, const FProperty* PropertyType);
+	/** @return validator from container for a given property class and struct cpp type, if property class is a struct property */
+	static const UPropertyValidatorBase* FindValidator(const TMap<FPropertyValidatorDescriptor, UPropertyValidatorBase*>& Container, const FFieldClass* PropertyClass, FName CppType = NAME_None);
 
 	void InitPropertyExtensionLibrary();
 	
@@ -187,13 +261,26 @@ protected:
 	UPROPERTY(Transient)
 	TArray<FString> ProjectPackages;
 
+	/** cached package validation decisions based on project packages and validation settings */
+	TSharedPtr<UE::AssetValidation::FPackageVerdictCache> PackageVerdicts;
+
 	/** List of all active validators */
 	UPROPERTY(Transient)
 	TArray<UPropertyValidatorBase*> AllValidators;
 
+	/** validators resolved for each property class, including property classes without validators */
+	TMap<const FFieldClass*, UE::AssetValidation::FPropertyValidatorDispatch> FieldClassDispatch;
+	/** validators resolved for struct properties of struct types that have dedicated validators */
+	TMap<const UScriptStruct*, UE::AssetValidation::FPropertyValidatorDispatch> StructDispatch;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UValidationEditorExtensionManager> ExtensionManager;
 
 	UPROPERTY(Transient)
 	FPropertyExtensionLibrary ExtensionLibrary;
+
+	/** validation plans compiled on first use, mapped by struct they describe */
+	mutable TMap<TObjectKey<UStruct>, TSharedPtr<UE::AssetValidation::FStructValidationPlan>> ValidationPlans;
+	/** guards validation plans, as property validation can run outside of the game thread */
+	mutable FRWLock ValidationPlanLock;
 };
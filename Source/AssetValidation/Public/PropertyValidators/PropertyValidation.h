@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "PropertyValidatorSubsystem.h"
 #include "Templates/NonNullPointer.h"
+#include "UObject/SoftObjectPath.h"
 #include "UObject/UObjectGlobals.h"
 
 struct FPropertyValidationResult;
@@ -37,6 +38,12 @@ namespace UE::AssetValidation
 	 * @return true if all metas can be applied to a property, false otherwise
 	 */
 	ASSETVALIDATION_API bool CheckPropertyMetaData(const FProperty* Property, const FMetaDataSource& MetaData, bool bLoggingEnabled);
+	/**
+	 * checks property meta data to see if any meta specifiers are placed incorrectly. Results are neither logged nor cached
+	 * @param OutErrors error messages for incorrectly placed meta specifiers
+	 * @return true if all metas can be applied to a property, false otherwise
+	 */
+	ASSETVALIDATION_API bool CheckPropertyMetaData(const FProperty* Property, const FMetaDataSource& MetaData, TArray<FString>& OutErrors);
 	/** @return true if "Validate" meta can be applied to given property */
 	bool CanApplyMeta_Validate(const FProperty* Property);
 	/** @return true if "ValidateRecursive" meta can be applied to given property */
@@ -63,6 +70,7 @@ namespace UE::AssetValidation
 	/** @return property underlying type name */
 	ASSETVALIDATION_API FString GetPropertyTypeName(const FProperty* Property);
 	/** @return object display name */
+	ASSETVALIDATION_API FString ResolveObjectDisplayName(const UObject* Object);
 	ASSETVALIDATION_API FString ResolveObjectDisplayName(const UObject* Object, FPropertyValidationContext& ValidationContext);
 
 	/**
@@ -81,6 +89,55 @@ namespace UE::AssetValidation
 	
 	/** @return whether package is a blueprint package */
 	ASSETVALIDATION_API bool IsBlueprintGeneratedPackage(const FString& PackageName);
+
+	/** What should be verified for a soft reference */
+	enum class ESoftReferenceCheck: uint8
+	{
+		/** referenced package exists */
+		Package,
+		/** referenced package and object exist */
+		Object,
+		/** referenced class exists and is compatible with property MetaClass or AllowedClasses */
+		Class
+	};
+
+	/** Soft reference queued for existence check at the end of property validation pass */
+	struct FSoftReferenceQuery
+	{
+		FSoftObjectPath Path;
+		/** property that holds the reference, class references are checked against its meta class */
+		const FProperty* Property = nullptr;
+		ESoftReferenceCheck Check = ESoftReferenceCheck::Package;
+	};
+
+	/**
+	 * Call @Func for each allocated element index of a script set or script map
+	 * Iteration stops after the last allocated element, compact containers are iterated without index validity checks
+	 */
+	template <typename TScriptContainerType, typename TFunc>
+	void ForEachAllocatedIndex(const TScriptContainerType& Container, TFunc&& Func)
+	{
+		const int32 Num = Container.Num();
+		const int32 MaxIndex = Container.GetMaxIndex();
+		if (Num == MaxIndex)
+		{
+			// no free slots
+			for (int32 Index = 0; Index < MaxIndex; ++Index)
+			{
+				Func(Index);
+			}
+			return;
+		}
+
+		for (int32 Index = 0, NumVisited = 0; NumVisited < Num; ++Index)
+		{
+			if (Container.IsValidIndex(Index))
+			{
+				Func(Index);
+				++NumVisited;
+			}
+		}
+	}
 }
 
 /**
@@ -89,15 +146,18 @@ namespace UE::AssetValidation
 class ASSETVALIDATION_API FPropertyValidationContext: public FNoncopyable
 {
 public:
+
+	/** Element of a context path, rendered only when property fails */
+	using FPathElement = UE::AssetValidation::FPropertyPathElement;
 	
 	/** Scoped prefix struct */
 	class FScopedPrefix
 	{
 	public:
-		FScopedPrefix(FPropertyValidationContext& InContext, const FString& Prefix)
+		FScopedPrefix(FPropertyValidationContext& InContext, FPathElement&& Prefix)
 			: Context(InContext)
 		{
-			Context.PushPrefix(Prefix);
+			Context.PushPrefix(MoveTemp(Prefix));
 		}
 		
 		~FScopedPrefix()
@@ -112,13 +172,13 @@ public:
 	class FConditionalPrefix
 	{
 	public:
-		FConditionalPrefix(FPropertyValidationContext& InContext, const FString& Prefix, bool bCondition)
+		FConditionalPrefix(FPropertyValidationContext& InContext, FPathElement&& Prefix, bool bCondition)
 			: Context(InContext)
 			, bPushed(bCondition)
 		{
 			if (bPushed)
 			{
-				Context.PushPrefix(Prefix);
+				Context.PushPrefix(MoveTemp(Prefix));
 			}
 		}
 
@@ -163,33 +223,48 @@ public:
 	}
 	
 	void PropertyFails(const FProperty* Property, const FText& DefaultFailureMessage);
+
+	/**
+	 * Queue existence check for a soft reference held by @Property. Queued references are resolved in a single batch
+	 * when validation result is made, property fails if referenced package, object or class doesn't exist, depending on @Check
+	 */
+	void CheckSoftReference(const FProperty* Property, const FSoftObjectPath& Path, UE::AssetValidation::ESoftReferenceCheck Check);
 	
-	/** push prefix to context string */
+	/** push prefix to context path */
 	FORCEINLINE void PushPrefix(const FString& Prefix)
 	{
 		check(!Prefix.IsEmpty());
-		
-		Prefixes.Push(Prefix);
-		ContextString.Append(Prefix + TEXT("."));
+		Prefixes.Emplace(Prefix);
+	}
+	
+	/** push prefix to context path, prefix is rendered only if property fails */
+	FORCEINLINE void PushPrefix(FPathElement&& Prefix)
+	{
+		Prefixes.Emplace(MoveTemp(Prefix));
 	}
 	
 	/** @return last pushed prefix */
 	FORCEINLINE FString GetPrefix() const
 	{
 		check(Prefixes.Num() > 0);
-		return Prefixes.Last();
+		return Prefixes.Last().ToString();
 	}
 
-	/** pop last prefix from context string */
+	/** pop last prefix from context path */
 	FORCEINLINE void PopPrefix()
 	{
 		check(Prefixes.Num() > 0);
-		const FString Prefix = Prefixes.Pop();
-		ContextString = ContextString.LeftChop(Prefix.Len() + 1);
+		Prefixes.Pop();
 	}
 
-	/** */
-	FPropertyValidationResult MakeValidationResult() const;
+	/**
+	 * Log incorrect meta usage found while compiling validation plan.
+	 * Errors are logged once per plan, so log capture attributes them to the first asset validated with the plan
+	 */
+	void ReportMetaDataErrors(TConstArrayView<FString> Errors);
+
+	/** @return validation result with issues gathered by validation context. Issues are formatted and cleared */
+	FPropertyValidationResult MakeValidationResult();
 	/** Route property container validation request to validator subsystem */
 	void IsPropertyContainerValid(TNonNullPtr<const uint8> ContainerMemory, const UStruct* Struct);
 	/** Route property validation request to validator subsystem */
@@ -230,26 +305,21 @@ private:
 		check(Objects.Num() > 0);
 		Objects.Pop();
 	}
-	
-	FText MakeFullMessage(const FText& FailureMessage, const FText& PropertyPrefix) const;
-	/** @return beautified name for an object */
-    FString GetBeautifiedName(const UObject* Object) const;
-	
-	struct FIssue
-	{
-		FText Message;
-		EMessageSeverity::Type Severity = EMessageSeverity::Info;
-		const FProperty* IssueProperty = nullptr;
-	};
 
-	TArray<FIssue> Issues;
-	/** Stack of prefixes appended to @ContextString */
-	TArray<FString> Prefixes;
+	/** Resolve queued soft references and confirm issues for the missing ones */
+	void ResolveSoftReferences();
+	
+	/** Property issues, formatted only when validation result is reported */
+	UE::AssetValidation::FPropertyIssueList Issues;
+	/** Soft references queued for existence check */
+	TArray<UE::AssetValidation::FSoftReferenceQuery> SoftReferences;
+	/** Pending issue index for each queued soft reference */
+	TArray<int32> SoftReferenceIssues;
 	/**
-	 * Context string that is added to "property fails" error message.
+	 * Stack of prefixes that is rendered to a context string and added to "property fails" error message.
 	 * Allows to understand property hierarchies for nested structs/arrays/objects
 	 */
-	FString ContextString = "";
+	TArray<FPathElement> Prefixes;
 	/** Weak reference to property validator subsystem */
 	TWeakObjectPtr<const UPropertyValidatorSubsystem> Subsystem;
 	/** Weak reference to the object chain, starting from which validation sequence has started */
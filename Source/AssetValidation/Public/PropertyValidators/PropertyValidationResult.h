@@ -1,13 +1,195 @@
 #pragma once
 
+#include "CoreMinimal.h"
+#include "Logging/TokenizedMessage.h"
+#include "Misc/DataValidation.h"
+
+namespace UE::AssetValidation
+{
+	/**
+	 * Element of a property validation context path, e.g. a property, an element of a container property or an object
+	 * Elements are cheap to push and pop, display string is rendered only when issue is formatted
+	 */
+	class ASSETVALIDATION_API FPropertyPathElement
+	{
+	public:
+		FPropertyPathElement(const FString& InName)
+			: Name(InName)
+		{}
+		explicit FPropertyPathElement(const FProperty* InProperty, int32 InIndex = INDEX_NONE, const TCHAR* InSuffix = nullptr)
+			: Property(InProperty)
+			, Index(InIndex)
+			, Suffix(InSuffix)
+			, Type(EType::Property)
+		{
+			check(Property);
+		}
+
+		/** @return path element for an object referenced by a property, displayed by its resolved display name */
+		static FPropertyPathElement FromObject(const UObject* InObject);
+		/** @return path element for an outer of validated object, displayed by its beautified name */
+		static FPropertyPathElement FromOuter(const UObject* InOuter);
+
+		/** @return display string of a path element */
+		FString ToString() const;
+
+		bool operator==(const FPropertyPathElement& Other) const;
+
+	private:
+		enum class EType: uint8
+		{
+			Name,
+			Property,
+			Object,
+			Outer
+		};
+		FPropertyPathElement() = default;
+
+		FString Name;
+		const FProperty* Property = nullptr;
+		const UObject* Object = nullptr;
+		/** container element index, INDEX_NONE for non-container properties */
+		int32 Index = INDEX_NONE;
+		/** optional suffix appended to display string, e.g. .Key or .Value for map elements */
+		const TCHAR* Suffix = nullptr;
+		EType Type = EType::Name;
+	};
+
+	/** Compact record of a property validation issue */
+	struct FPropertyValidationIssue
+	{
+		/** property display name appended to context path, nullptr if failed property is a container element */
+		const FProperty* Property = nullptr;
+		/** failed property, custom failure message is looked up on it */
+		const FProperty* SourceProperty = nullptr;
+		/** index of an interned failure message, INDEX_NONE for pending issues */
+		int32 MessageIndex = INDEX_NONE;
+		/** range of context path elements */
+		int32 PathIndex = 0;
+		int32 PathNum = 0;
+		EMessageSeverity::Type Severity = EMessageSeverity::Error;
+	};
+
+	/**
+	 * Property Issue List
+	 * Stores property validation issues as compact records. Failure messages are interned and shared between issues,
+	 * issues with the same context path share path elements. Issue text is formatted only when it is requested,
+	 * which should happen right after validation, as records reference properties and objects of validated data
+	 */
+	class ASSETVALIDATION_API FPropertyIssueList
+	{
+	public:
+		/**
+		 * Add an issue for a failed property
+		 * @param Property failed property, custom failure message is looked up on it
+		 * @param DefaultFailureMessage failure message used if property doesn't specify custom one
+		 * @param Path context path of a failed property
+		 */
+		void Add(EMessageSeverity::Type Severity, const FProperty* Property, const FText& DefaultFailureMessage, TConstArrayView<FPropertyPathElement> Path);
+
+		/**
+		 * Add an issue which failure is not known yet, e.g. existence check that is resolved later
+		 * Pending issue is neither counted nor formatted until its failure message is set
+		 * @return pending issue index
+		 */
+		int32 AddPending(EMessageSeverity::Type Severity, const FProperty* Property, TConstArrayView<FPropertyPathElement> Path);
+		/** Confirm pending issue with a failure message, custom failure message of a property takes precedence */
+		void SetFailureMessage(int32 IssueIndex, const FText& DefaultFailureMessage);
+		/** Remove pending issues that weren't confirmed. Invalidates pending issue indices */
+		void RemovePending();
+
+		/** @return number of issues with a given severity */
+		int32 Num(EMessageSeverity::Type Severity) const;
+
+		/** Format issues with a given severity and append them to @OutMessages */
+		void Format(EMessageSeverity::Type Severity, TArray<FText>& OutMessages) const;
+
+	private:
+		int32 InternMessage(const FText& Message);
+
+		TArray<FPropertyValidationIssue> Issues;
+		/** interned failure messages */
+		TArray<FText> Messages;
+		TMap<FString, int32> MessageIndices;
+		/** interned custom failure messages mapped by property, INDEX_NONE if property doesn't have one */
+		TMap<const FProperty*, int32> PropertyMessageIndices;
+		/** context path elements of all issues */
+		TArray<FPropertyPathElement> PathElements;
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+	};
+
+	/**
+	 * Property Message List
+	 * Property validation messages of a single severity, used as an array of formatted messages.
+	 * Messages are formatted from gathered issues on first access, message count is known without formatting.
+	 * Issues reference properties and objects of validated data, so messages should be accessed before validated data is destroyed
+	 */
+	class ASSETVALIDATION_API FPropertyMessageList
+	{
+	public:
+		FPropertyMessageList() = default;
+		FPropertyMessageList(const TSharedRef<const FPropertyIssueList>& InIssues, EMessageSeverity::Type InSeverity)
+			: Issues(InIssues)
+			, Severity(InSeverity)
+		{}
+
+		/** @return number of messages, without formatting them */
+		FORCEINLINE int32 Num() const { return Messages.Num() + (Issues.IsValid() ? Issues->Num(Severity) : 0); }
+		FORCEINLINE bool IsEmpty() const { return Num() == 0; }
+
+		/** @return formatted messages */
+		FORCEINLINE const TArray<FText>& Get() const
+		{
+			if (Issues.IsValid())
+			{
+				FormatIssues();
+			}
+			return Messages;
+		}
+		FORCEINLINE operator const TArray<FText>&() const { return Get(); }
+		FORCEINLINE const FText& operator[](int32 Index) const { return Get()[Index]; }
+
+		FORCEINLINE void Add(const FText& Message)
+		{
+			Get();
+			Messages.Add(Message);
+		}
+
+		FORCEINLINE auto begin() const { return Get().begin(); }
+		FORCEINLINE auto end() const { return Get().end(); }
+
+	private:
+		/** Format gathered issues, messages added explicitly go after them */
+		void FormatIssues() const;
+
+		/** issues shared between message lists of the same validation result, released once they're formatted */
+		mutable TSharedPtr<const FPropertyIssueList> Issues;
+		mutable TArray<FText> Messages;
+		EMessageSeverity::Type Severity = EMessageSeverity::Error;
+	};
+}
+
 struct ASSETVALIDATION_API FPropertyValidationResult
 {
 	FPropertyValidationResult() = default;
 	FPropertyValidationResult(EDataValidationResult InResult)
 		: ValidationResult(InResult)
 	{ }
-	
-	TArray<FText> Errors;
-	TArray<FText> Warnings;
+
+	/** @return number of property errors */
+	FORCEINLINE int32 NumErrors() const { return Errors.Num(); }
+	/** @return number of property warnings */
+	FORCEINLINE int32 NumWarnings() const { return Warnings.Num(); }
+
+	/** @return formatted property errors */
+	FORCEINLINE const TArray<FText>& GetErrors() const { return Errors.Get(); }
+	/** @return formatted property warnings */
+	FORCEINLINE const TArray<FText>& GetWarnings() const { return Warnings.Get(); }
+
+	/** property errors, formatted from gathered issues on first access */
+	UE::AssetValidation::FPropertyMessageList Errors;
+	/** property warnings, formatted from gathered issues on first access */
+	UE::AssetValidation::FPropertyMessageList Warnings;
 	EDataValidationResult ValidationResult = EDataValidationResult::NotValidated;
-};
\ No newline at end of file
+};